@@ -31,22 +31,34 @@
 #include <avr/pgmspace.h>
 #include <avr/eeprom.h>
 #include <avr/wdt.h>
+#include <avr/sleep.h>
 #include <DS323x.h>
 #include <nDisplay.h>
 #include <nAudio.h>
 #include <nI2C.h>
 #include "Music.h"
+#include "TubeDriver.h"
 
 const uint8_t VERSION       = 10;
-const uint8_t DISPLAY_COUNT = 8;
-const char CONFIG_KEY       = '$';
+const char CONFIG_KEY       = '\'';
 const uint8_t ALARM_COUNT   = 3;
+const uint8_t BLANK_WINDOW_COUNT = 3;
 
-// Macros to simplify port manipulation without additional overhead
-#define getPort(pin)    ((pin < 8) ? PORTD : ((pin < A0) ? PORTB : PORTC))
-#define getMask(pin)    _BV((pin < 8) ? pin : ((pin < A0) ? pin - 8 : pin - A0))
-#define setPinHigh(pin) (getPort(pin) |= getMask(pin))
-#define setPinLow(pin)  (getPort(pin) &= ~getMask(pin))
+// DS3232 registers for direct access
+const uint8_t DS3232_ADDRESS = 0x68;
+const uint8_t DS3232_REGISTER_TIME = 0x00; // Seconds through year, BCD
+const uint8_t DS3232_REGISTER_TEMPERATURE = 0x11; // MSB integer, LSB bits 7:6 quarters
+
+// EEPROM memory map
+enum EEPROMAddress : uint16_t
+{
+    EEPROM_CONFIG  = 0,   // Config (128 bytes reserved)
+    EEPROM_CATHODE = 128, // Cathode lit time (320 bytes)
+    EEPROM_HISTORY = 448, // Temperature history (320 bytes)
+    EEPROM_TIMEZONE = 768, // Timezone transition index (3 bytes)
+    EEPROM_CRASH   = 772, // Watchdog crash record (7 bytes)
+    EEPROM_PROFILE = 784, // Site profile Config and CRC (130 bytes)
+};
 
 enum digital_pin_t : uint8_t
 {
@@ -68,17 +80,88 @@ enum button_t : uint8_t
     BUTTON_B = DIGITAL_PIN_BUTTON_0,
 };
 
+// Port manipulation resolved at compile time - reduces to sbi/cbi/sbis
+template<digital_pin_t pin> struct FastPin
+{
+    static_assert(pin < 20, "Pin not mapped to PORTB, PORTC or PORTD");
+
+    // ATmega328P PINx, DDRx and PORTx are consecutive in data memory
+    static constexpr uint8_t ADDRESS = (pin < 8) ? 0x29 : ((pin < A0) ? 0x23 : 0x26);
+    static constexpr uint8_t MASK = _BV((pin < 8) ? pin : ((pin < A0) ? pin - 8 : pin - A0));
+
+    static inline volatile uint8_t& Input(void)
+    {
+        return *reinterpret_cast<volatile uint8_t*>(ADDRESS);
+    }
+
+    static inline volatile uint8_t& Output(void)
+    {
+        return *reinterpret_cast<volatile uint8_t*>(ADDRESS + 2);
+    }
+
+    static inline bool IsHigh(void)
+    {
+        return (Input() & MASK);
+    }
+
+    static inline void SetHigh(void)
+    {
+        Output() |= MASK;
+    }
+
+    static inline void SetLow(void)
+    {
+        Output() &= ~MASK;
+    }
+
+    static inline void Write(const bool value)
+    {
+        if (value)
+        {
+            SetHigh();
+        }
+        else
+        {
+            SetLow();
+        }
+    }
+};
+
+typedef FastPin<digital_pin_t(BUTTON_A)> PinButtonA;
+typedef FastPin<digital_pin_t(BUTTON_B)> PinButtonB;
+
+// Board variant - DivergenceMeterTubes5441A-4.1 with 8 tubes
+typedef CTubeDriver<FastPin<DIGITAL_PIN_CLOCK>, FastPin<DIGITAL_PIN_SDATA>, 8,
+                    10, 1, 2, 6, 7, 8, 9, 4, 5, 3, 0, 11> TubeDriver;
+
+const uint8_t DISPLAY_COUNT = TubeDriver::TUBE_COUNT;
+
 enum analog_pin_t : uint8_t
 {
     ANALOG_PIN_PHOTODIODE = A3,
 };
 
+enum BootStage : uint8_t
+{
+    BOOT_SETUP,     // setup() entered
+    BOOT_DISPLAY,   // Cached display lit
+    BOOT_CONFIG,    // Full Config decoded
+    BOOT_RTC,       // RTC initialized
+    BOOT_TIME,      // Current time displayed
+    BOOT_STAGE_COUNT,
+};
+
 enum interrupt_speed_t : uint8_t
 {
     INTERRUPT_FAST = 32, // 16MHz / (60Hz * 8 levels * 1024 prescaler)
     INTERRUPT_SLOW = 255,
 };
 
+const uint8_t TRANSITION_STEPS = 8; // Mix levels, one per PWM phase
+const uint8_t TRANSITION_FRAMES = 4; // Frames per mix level (~0.5s fade)
+const uint8_t PROFILE_TICK_US = 4; // TCNT0 resolution with 64 prescaler
+const uint8_t PROFILE_BUDGET = 100; // Display ISR budget in TCNT0 ticks
+
 enum class FormatDate : uint8_t
 {
     YYMMDD,
@@ -92,6 +175,21 @@ enum class FormatTime : uint8_t
     H12,
 };
 
+enum class SyncMode : uint8_t
+{
+    DISABLE,
+    MASTER,     // Broadcast second edges
+    FOLLOWER,   // Latch on received edges and forward downstream
+};
+
+enum class SolarMode : uint8_t
+{
+    DISABLE,
+    BRIGHTNESS, // Bias automatic brightness
+    BLANK,      // Blank display after sunset
+    ALL,        // Both of the above
+};
+
 enum class Cycle : uint8_t
 {
     AM,
@@ -135,6 +233,8 @@ struct StateStruct
     : voltage(State::DISABLE)
     , display(State::DISABLE)
     , alarm(State::DISABLE)
+    , transition(State::DISABLE)
+    , solar(0)
     {
         // empty
     }
@@ -142,6 +242,21 @@ struct StateStruct
     State voltage;
     State display;
     State alarm;
+    State transition;
+    int16_t solar; // Sine of sun elevation, Q14
+};
+
+struct TransitionStruct
+{
+    char        from[DISPLAY_COUNT];    // Unit values before change
+    uint8_t     mix[DISPLAY_COUNT];     // PWM phases showing new value
+};
+
+struct ProfileStruct
+{
+    volatile uint8_t    last;       // TCNT0 ticks
+    volatile uint8_t    maximum;    // TCNT0 ticks
+    volatile uint16_t   overrun;    // Interrupts exceeding budget
 };
 
 struct AlarmStruct
@@ -161,6 +276,28 @@ struct AlarmStruct
     uint32_t    time;
 };
 
+// Display blanked from begin to end minute on each selected day
+struct BlankWindowStruct
+{
+    BlankWindowStruct()
+    : days(0)
+    , begin(0)
+    , end(0)
+    {
+        // empty
+    }
+
+    uint8_t     days;   // Bit per RTC week day as alarm
+    uint16_t    begin;  // Minute of day - equal to end blanks whole day
+    uint16_t    end;    // Minute of day - before begin ends next day
+};
+
+struct DisplayCacheStruct
+{
+    char        value[DISPLAY_COUNT];
+    uint16_t    check;  // CRC-16 of value
+};
+
 struct Config
 {
     Config()
@@ -173,9 +310,11 @@ struct Config
     , date_format(FormatDate::DDMMYY)
     , time_format(FormatTime::H24)
     , temperature_unit(CRTC::Unit::F)
-    , blank_begin(0)
-    , blank_end(0)
     , music_timer(0)    
+    , solar(SolarMode::DISABLE)
+    , latitude(0)
+    , longitude(0)
+    , sync(SyncMode::DISABLE)
     {
         // Empty
     }
@@ -189,10 +328,13 @@ struct Config
     FormatDate              date_format;
     FormatTime              time_format;
     CRTC::Unit              temperature_unit;
-    uint32_t                blank_begin;
-    uint32_t                blank_end;
     uint8_t                 music_timer;
     AlarmStruct             alarm[ALARM_COUNT];
+    BlankWindowStruct       blank[BLANK_WINDOW_COUNT];
+    SolarMode               solar;
+    int16_t                 latitude;   // Tenths of degree, north positive
+    int16_t                 longitude;  // Tenths of degree, east positive
+    SyncMode                sync;       // Appended so earlier fields keep their place
 };
 
 // Return integral value of Enumeration
@@ -226,23 +368,33 @@ template<typename T> constexpr uint8_t getValue(const T e)
 // Mode functions
 void EffectWorldLine(const uint32_t value, const uint8_t omega);
 void DivergenceMeter(void);
-void Timer(uint8_t hour, uint8_t minute, uint8_t second);
 void Detonate(void);
-void PlayAlarm(const uint8_t song_index, const char* phrase);
+void PlayAlarm(const uint8_t song_index, const __FlashStringHelper* phrase);
 
 // Automatic functions
 void AutoBrightness(void);
-void AutoBlanking(void);
+void AutoSecond(CRTC::RTC& rtc);
+void AutoBlanking(const CRTC::RTC& rtc);
+void AutoSolar(const CRTC::RTC& rtc);
 void AutoAlarm(void);
+void AutoCathode(void);
+void AutoHistory(void);
 
 // Update functions
 void UpdateAlarmIndicator(void);
+void UpdateBlankSchedule(void);
 
 // Format functions
 uint8_t FormatHour(const uint8_t hour);
 void FormatRTCString(const CRTC::RTC& rtc, char* s, const RTCSelect type);
 uint32_t GetSeconds(const uint8_t hour, const uint8_t minute, const uint8_t second);
 
+// Boot functions
+void BootDisplay(void);
+void CacheDisplay(const char* s);
+uint16_t GetCacheCheck(const DisplayCacheStruct& cache);
+bool IsCacheValid(const DisplayCacheStruct& cache);
+
 // Analog functions
 CDisplay::Brightness ReadLightIntensity(void);
 
@@ -253,8 +405,12 @@ void SetConfig(const Config& g_config);
 // State functions
 void VoltageState(const State state);
 void DisplayState(const State state);
+void DisplayTransition(const char* s);
 void ButtonState(const State state);
 
+// Power functions
+bool PowerSave(const CRTC::RTC& rtc);
+
 // Interrupt functions
 void InterruptSpeed(const uint8_t speed);
 
@@ -25,8 +25,23 @@
  * @data        14 August 2018
  */
 
+#include <util/crc16.h>
 #include "B5441-Nixie-Clock.h"
 #include "Menu.h"
+#include "Cathode.h"
+#include "Countdown.h"
+#include "History.h"
+#include "Temperature.h"
+#include "Schedule.h"
+#include "Timezone.h"
+#include "Solar.h"
+#include "Snapshot.h"
+#include "Supervisor.h"
+#include "Sync.h"
+#include "Telemetry.h"
+#include "Trace.h"
+#include "Digits.h"
+#include "Inject.h"
 
 //---------------------------------------------------------------------
 // Global Variables
@@ -41,6 +56,15 @@ CDisplay        g_display{DISPLAY_COUNT};
 
 // Container variables
 CRTC::RTC*      g_rtc_struct;
+CI2C::Handle    g_rtc_device;   // Direct register access
+uint32_t        g_boot_trace[BOOT_STAGE_COUNT]; // Microseconds since reset
+
+TransitionStruct g_transition;
+BlankScheduleStruct g_blank_schedule;
+ProfileStruct   g_profile;
+
+// Retained across resets while SRAM remains powered
+DisplayCacheStruct g_display_cache __attribute__((section(".noinit")));
 
 // Integral variables
 uint8_t         g_song_entries = INBUILT_SONG_COUNT;
@@ -51,6 +75,9 @@ volatile uint8_t g_button_timeout_A = 0;
 volatile uint16_t g_button_timeout_B = 0;
 volatile uint8_t g_button_timeout = 0;
 
+// Display variables
+volatile uint8_t g_display_frame = 0; // Incremented per refresh
+
 //---------------------------------------------------------------------
 // Functions
 //---------------------------------------------------------------------
@@ -62,6 +89,7 @@ void loop(void)
     char s[DISPLAY_COUNT + 1];
     
     g_rtc_struct = &rtc; // Assign global pointer
+    rtc.second = 0xFF; // Force display of first reading
     
     GetConfig(g_config);
 
@@ -71,6 +99,14 @@ void loop(void)
         SetConfig(new_config); // Write to EEPROM
         GetConfig(g_config); // Read from EEPROM
     }
+
+    // Appended field is erased EEPROM when written by an earlier layout
+    if (g_config.sync > SyncMode::FOLLOWER)
+    {
+        g_config.sync = SyncMode::DISABLE;
+    }
+
+    g_boot_trace[BOOT_CONFIG] = micros();
     
     // Initialize Display
     g_display.SetCallbackIsIncrement(IsInputIncrement);
@@ -83,54 +119,113 @@ void loop(void)
     
     // Initialize RTC
     g_rtc.Initialize();
+    g_rtc_device = nI2C->RegisterDevice(DS3232_ADDRESS, 1, CI2C::Speed::FAST);
+    TimezoneInitialize();
+    g_boot_trace[BOOT_RTC] = micros();
     UpdateAlarmIndicator();
+    UpdateBlankSchedule();
+    HistoryInitialize();
 
     while (true)
     {
+        SupervisorCheckIn(TASK_LOOP);
         AutoBrightness();
+        AutoCountdown();
+        TelemetryProcess();
+        SyncProcess();
         previous_second = rtc.second;
-        g_rtc.GetRTC(rtc);
+        bool fresh = SnapshotPoll(rtc); // Latest completed read - never waits on bus
         
         if (rtc.second != previous_second)
         {
+            TRACE_MARK(TRACE_SECOND, rtc.second);
+            g_state.transition = State::DISABLE; // Effects below are hard cuts
+            AutoSecond(rtc);
+            
             switch (rtc.second)
             {
             case 0:
-                AutoBlanking();
-                AutoAlarm();
+                if (IsCathodeExercise())
+                {
+                    break; // Exercise owns the tubes - followers render alone
+                }
 
                 g_display.SetDisplayIndicator(false);
-                g_display.EffectScroll(F(";:;:;:;:"), CDisplay::Direction::LEFT, 80);
+                TRACE_BEGIN(TRACE_EFFECT, TRACE_EFFECT_SCROLL);
+                g_display.EffectScroll(GetLabel(LABEL_SEPARATOR), CDisplay::Direction::LEFT, 80);
                 g_rtc.GetRTC(rtc); // Refresh RTC
                 FormatRTCString(rtc, s, RTCSelect::TIME);
                 g_display.EffectScroll(s, CDisplay::Direction::LEFT, 80);
+                TRACE_END(TRACE_EFFECT, TRACE_EFFECT_SCROLL);
                 break;
 
             case 30:
+                if (IsCathodeExercise())
+                {
+                    break;
+                }
+
                 g_display.SetDisplayIndicator(false);
                 FormatRTCString(rtc, s, RTCSelect::DATE);
                 g_display.SetDisplayValue(s);
+                TRACE_BEGIN(TRACE_EFFECT, TRACE_EFFECT_SLOT);
                 g_display.EffectSlotMachine(44);
+                TRACE_END(TRACE_EFFECT, TRACE_EFFECT_SLOT);
                 delay(1950);
                 break;
 
             default:
+                if (IsCathodeExercise())
+                {
+                    break;
+                }
+
                 bool pip = (!rtc.am && (g_config.time_format == FormatTime::H12));
                 g_display.SetUnitIndicator(0, getValue(g_state.alarm)); // Alarm
+                g_display.SetUnitIndicator(2, IsCountdownActive()); // Timer
                 g_display.SetUnitIndicator(5, pip); // AM/PM
                 FormatRTCString(rtc, s, RTCSelect::TIME);
-                g_display.SetDisplayValue(s);
+
+                switch (g_config.sync)
+                {
+                case SyncMode::MASTER:
+                    SyncMaster(rtc, s); // Latched after common delay
+                    break;
+
+                case SyncMode::FOLLOWER:
+                    if (IsSyncExpected(rtc.second))
+                    {
+                        break; // Latched on master edge
+                    }
+                    [[gnu::fallthrough]]; // Fall-through
+
+                default:
+                    DisplayTransition(s);
+                    break;
+                }
+
+                CacheDisplay(s);
                 break;
             }
+
+            if (!g_boot_trace[BOOT_TIME])
+            {
+                g_boot_trace[BOOT_TIME] = micros();
+            }
         }
 
         if (IsInputUpdate() || IsInputSelect())
         {
+            g_state.transition = State::DISABLE;
+            
             // Check if time threshold elapsed
             if (g_button_timeout == 0)
             {
-                // Check if display is disabled
-                if (g_state.display == State::DISABLE)
+                if (IsCathodeExercise())
+                {
+                    CathodeExerciseStop(); // Leave display enabled for user
+                }
+                else if (g_state.display == State::DISABLE)
                 {
                     DisplayState(State::ENABLE);
                 }
@@ -161,6 +256,12 @@ void loop(void)
         {
             g_button_timeout--;
         }
+
+        // Drop to power-save sleep while blanked - sleep length needs current time
+        if (fresh && (g_state.display == State::DISABLE) && PowerSave(rtc))
+        {
+            continue; // Resume after wake
+        }
         
         delay(50); // Idle
     }
@@ -169,8 +270,10 @@ void loop(void)
 
 void EffectWorldLine(const uint32_t value, const uint8_t omega)
 {
+    char s[DISPLAY_COUNT + 1];
+    FormatDigits(s, value);
     g_display.SetDisplayBrightness(CDisplay::Brightness::L5);
-    g_display.SetDisplayValue(value);
+    g_display.SetDisplayValue(s);
     g_display.SetUnitValue(1, ':');
 
     if ((value >= 100000000) || (omega && (value < 600000)))
@@ -191,6 +294,8 @@ void EffectWorldLine(const uint32_t value, const uint8_t omega)
 
 void DivergenceMeter(void)
 {
+    const uint16_t CYCLE = 3000; // Milliseconds per continuous cycle
+    const uint32_t IDLE = 330000; // Milliseconds of inactivity before exit
     uint8_t meter_mode = 0;
     uint8_t continuous = 0;
     uint8_t cycle = 0;
@@ -200,7 +305,10 @@ void DivergenceMeter(void)
     while (1)
     {
         uint32_t count;
-        uint32_t timeout;
+        uint32_t start;
+        uint32_t elapsed = 0;
+
+        SupervisorCheckIn(TASK_LOOP); // Meter cycle
 
         switch (meter_mode)
         {
@@ -253,23 +361,30 @@ void DivergenceMeter(void)
             break;
         }
 
-        count = 250000; // 3 second delay
-        timeout = 25000000; // timeout after 5.5 minutes of inactivity
-
+        start = millis();
         IsInputUpdate(); // Clear any update
-        while (timeout && count && !IsInputUpdate() && !IsInputSelect())
+
+        // Wait ends by deadline so it may check in as time advances
+        while ((elapsed < IDLE) && !(continuous && (elapsed >= CYCLE)) &&
+               !IsInputUpdate() && !IsInputSelect())
         {
-            count -= continuous;
-            timeout--;
+            SupervisorCheckIn(TASK_LOOP);
+            elapsed = millis() - start;
+        }
+
+        if (elapsed >= IDLE)
+        {
+            g_display.SetDisplayBrightness(g_config.brightness);
+            return;
         }
 
-        if (count)
+        if (!(continuous && (elapsed >= CYCLE)))
         {
             if (!IsInputSelect())
             {
                 count = 100000;
 
-                while (count && (digitalRead(BUTTON_B) == HIGH))
+                while (count && PinButtonB::IsHigh())
                 {
                     count--;
                 }
@@ -304,72 +419,21 @@ void DivergenceMeter(void)
                 }
             }
         }
-
-        if (!timeout)
-        {
-            g_display.SetDisplayBrightness(g_config.brightness);
-            return;
-        }
     }
 }
 
 
-void Timer(uint8_t hour, uint8_t minute, uint8_t second)
-{
-    const char* format_string = PSTR("%02u%c%02u%c%02u");
-    char s[DISPLAY_COUNT + 1];
-    uint8_t previous_second;
-
-    CRTC::RTC rtc;
-    g_rtc.GetRTC(rtc);
-    previous_second = rtc.second;
-
-    while ((second + minute + hour) > 0)
-    {
-        if (previous_second != rtc.second)
-        {
-            if (second == 0)
-            {
-                if (minute == 0)
-                {
-                    hour--;
-                    minute = 59; // Reset
-                }
-                
-                minute--;
-                second = 59; // Reset
-            }
-            
-            second--;
-            previous_second = rtc.second;
-            
-            char c = ((rtc.second & 0x1) ? ';' : ':');
-            snprintf_P(s, DISPLAY_COUNT + 1, format_string, hour, c, minute, c, second);
-            g_display.SetDisplayValue(s);
-        }
-
-        delay(50);
-        g_rtc.GetRTC(rtc);
-
-        if (IsInputSelect())
-        {
-            return;
-        }
-    }
-
-    PlayAlarm(g_config.music_timer, "00000000");
-}
-
-
 void Detonate(void)
 {
+    char s[DISPLAY_COUNT + 1];
     uint32_t countdown = 99999;
     uint16_t value = 2500;
     uint16_t timer = 0;
     uint8_t count = 0;
 
     ButtonState(State::DISABLE); // Disable buttons
-    g_display.SetDisplayValue(countdown);
+    FormatDigits(s, countdown);
+    g_display.SetDisplayValue(s);
     g_display.SetDisplayBrightness(CDisplay::Brightness::MAX);
     InterruptSpeed(INTERRUPT_SLOW);
     
@@ -379,7 +443,9 @@ void Detonate(void)
 
     do
     {
-        g_display.SetDisplayValue(countdown);
+        SupervisorCheckIn(TASK_LOOP);
+        FormatDigits(s, countdown);
+        g_display.SetDisplayValue(s);
 
         if (++timer >= value)
         {
@@ -392,7 +458,7 @@ void Detonate(void)
         }
     } while (--countdown > 150);
 
-    g_display.SetDisplayValue(F("00000000"));
+    g_display.SetDisplayValue(GetLabel(LABEL_ZERO));
     g_audio.Play(CAudio::Functions::PGMStream, music_detonate_fuse_A, music_detonate_fuse_A);
     delay(500);
 
@@ -409,14 +475,14 @@ void Detonate(void)
             }
             
             delay(20);
-            g_display.SetDisplayValue(F("00000000")); // Restore
+            g_display.SetDisplayValue(GetLabel(LABEL_ZERO)); // Restore
         }
     }
     
-    g_display.SetDisplayValue(F("<<<<<<<<")); // Connect all anodes
+    g_display.SetDisplayValue(GetLabel(LABEL_ANODE)); // Connect all anodes
     g_audio.Play(CAudio::Functions::PGMStream, music_detonate_end_A, music_detonate_end_B);
     delay(1000);
-    g_display.SetDisplayValue(F("        "));
+    g_display.SetDisplayValue(GetLabel(LABEL_BLANK));
     delay(3000);
     ButtonState(State::ENABLE); // Enable buttons
     InterruptSpeed(INTERRUPT_FAST);
@@ -424,7 +490,7 @@ void Detonate(void)
 }
 
 
-void PlayAlarm(const uint8_t song_index, const char* phrase)
+void PlayAlarm(const uint8_t song_index, const __FlashStringHelper* phrase)
 {
     uint8_t elapsed_seconds = 0;
     bool toggle_state = false;
@@ -458,17 +524,19 @@ void PlayAlarm(const uint8_t song_index, const char* phrase)
             {
                 toggle_state = true;
                 elapsed_seconds++;
-                g_display.SetDisplayValue(F("        "));
+                g_display.SetDisplayValue(GetLabel(LABEL_BLANK));
             }
         }
 
         delay(50);
         audio_active = g_audio.IsActive();
+        SupervisorCheckIn(TASK_LOOP); // Alarm outlasts deadline
         
     } while (((elapsed_seconds < 120) || audio_active) &&
              !(IsInputUpdate() || IsInputSelect()));
             
     g_audio.Stop(); // Ensure music is stopped
+    TRACE_MARK(TRACE_AUDIO, 0xFF);
     
     g_button_timeout = 10;
     InterruptSpeed(INTERRUPT_FAST);
@@ -478,7 +546,7 @@ void PlayAlarm(const uint8_t song_index, const char* phrase)
 
 void AutoBrightness(void)
 {
-    if (g_config.brightness == CDisplay::Brightness::AUTO)
+    if ((g_config.brightness == CDisplay::Brightness::AUTO) && !IsCathodeExercise())
     {
         CDisplay::Brightness brightness;
         brightness = ReadLightIntensity();
@@ -487,20 +555,58 @@ void AutoBrightness(void)
 }
 
 
-void AutoBlanking(void)
+// Evaluated every second so an effect or menu cannot hide a transition.
+// Blank while the schedule or darkness asks and act only when that level
+// changes, so a button press keeps the display lit until the next change.
+void AutoBlanking(const CRTC::RTC& rtc)
 {
-    if (g_config.blank_begin != g_config.blank_end)
+    static bool previous = false; // Display is lit at boot
+    uint16_t minute = GetWeekMinute(rtc.week_day, rtc.hour, rtc.minute);
+
+    GetBlankEvent(g_blank_schedule, minute); // Advance schedule state
+    bool blank = (g_blank_schedule.blanked ||
+                  (IsSolarMode(g_config.solar, SolarMode::BLANK) && (g_state.solar < SOLAR_HORIZON)));
+
+    if (blank != previous)
     {
-        uint32_t seconds = g_rtc.GetTimeSeconds();
+        previous = blank;
+        CathodeExerciseStop();
+        DisplayState(blank ? State::DISABLE : State::ENABLE);
+    }
+}
 
-        if (seconds == g_config.blank_end)
-        {
-            DisplayState(State::ENABLE);
-        }
-        else if (seconds == g_config.blank_begin)
+
+// Duties of each new second that do not draw the clock face - also run by
+// modes that replace the main loop so alarms and schedules are never missed
+void AutoSecond(CRTC::RTC& rtc)
+{
+    AutoSolar(rtc);
+    AutoBlanking(rtc);
+    CathodeExerciseStep();
+
+    if (rtc.second == 0)
+    {
+        if (AutoTimezone(rtc))
         {
-            DisplayState(State::DISABLE);
+            g_rtc.GetRTC(rtc); // Adjusted wall time
         }
+
+        AutoAlarm();
+        AutoCathode();
+        AutoHistory();
+    }
+}
+
+
+// Sun position changes slowly - evaluate once per minute
+void AutoSolar(const CRTC::RTC& rtc)
+{
+    static uint8_t minute = 0xFF;
+
+    if (rtc.minute != minute)
+    {
+        minute = rtc.minute;
+        g_state.solar = GetSolarElevation(g_config, rtc, GetTimezoneOffset());
     }
 }
 
@@ -508,64 +614,55 @@ void AutoBlanking(void)
 void AutoAlarm(void)
 {
     uint32_t current_time = GetSeconds(g_rtc_struct->hour, g_rtc_struct->minute, 0);
-    
-    for (uint8_t index = 0; index < ALARM_COUNT; index++)
+    int8_t index = GetAlarmDue(g_config, g_rtc_struct->week_day, current_time);
+
+    if (index > -1)
     {
-        // Check if alarm is enabled
-        if (g_config.alarm[index].state == State::ENABLE)
-        {
-            // Check if alarm day matches current day
-            if ((g_config.alarm[index].days >> g_rtc_struct->week_day) & 0x1)
-            {
-                // Check if alarm time matches current time
-                if (g_config.alarm[index].time == current_time)
-                {
-                    PlayAlarm(g_config.alarm[index].music, "1.048596");
-                    break; // No need to process remaining alarms
-                }
-            }
-        }
+        PlayAlarm(g_config.alarm[index].music, GetLabel(LABEL_ATTRACTOR));
     }
     
     UpdateAlarmIndicator();
 }
 
 
+void AutoCathode(void)
+{
+    CathodePersist(false);
+
+    // Exercise under-used cathodes once per blanked hour
+    if ((g_state.display == State::DISABLE) && (g_rtc_struct->minute == 30))
+    {
+        CathodeExerciseStart(); // Stepped each second from main loop
+    }
+}
+
+
+// Log temperature hourly in quarter degrees Celsius
+void AutoHistory(void)
+{
+    if (g_rtc_struct->minute == 0)
+    {
+        HistorySample(GetHourStamp(*g_rtc_struct), GetTemperatureQuarter());
+    }
+}
+
+
+// Rebuild after blank windows change - state is reconciled on next call
+void UpdateBlankSchedule(void)
+{
+    BlankCompile(g_config, g_blank_schedule);
+}
+
+
 void UpdateAlarmIndicator(void)
 {
     CRTC::RTC rtc;
-    uint8_t day;
-    State next_state = State::DISABLE; // Assume disabled
     
     g_rtc.GetRTC(rtc);
     uint32_t current_time = GetSeconds(rtc.hour, rtc.minute, 0);
-    
-    for (uint8_t index = 0; index < ALARM_COUNT; index++)
-    {
-        // Check if alarm is enabled
-        if (g_config.alarm[index].state == State::ENABLE)
-        {
-            // Determine which day to check
-            if (g_config.alarm[index].time > current_time)
-            {
-                day = rtc.week_day; // Today
-            }
-            else
-            {
-                day = (rtc.week_day > 6) ? 1 : (rtc.week_day + 1); // Tomorrow
-            }
-
-            // Check if alarm is active for selected day
-            if ((g_config.alarm[index].days >> day) & 0x1)
-            {
-                next_state = State::ENABLE;
-                break; // Alarm will be indicated - no need to continue
-            }
-        }
-    }
 
     // Update alarm indicator
-    g_state.alarm = static_cast<decltype(g_state.alarm)>(next_state);
+    g_state.alarm = GetAlarmIndicator(g_config, rtc.week_day, current_time);
 }
 
 
@@ -586,43 +683,50 @@ uint8_t FormatHour(const uint8_t hour)
 
 void FormatRTCString(const CRTC::RTC& rtc, char* s, const RTCSelect type)
 {
-    const char* format_string = PSTR("%02u%c%02u%c%02u");
+    uint8_t value[3];
     char c;
 
     if (type == RTCSelect::TIME)
     {
         c = ((rtc.second & 0x1) ? ';' : ':');
+        value[0] = FormatHour(rtc.hour);
+        value[1] = rtc.minute;
+        value[2] = rtc.second;
     }
     else
     {
         c = ' ';
-    }
-    
-    switch (type)
-    {
-    case RTCSelect::TIME:
-        snprintf_P(s, DISPLAY_COUNT + 1, format_string, FormatHour(rtc.hour), c, rtc.minute, c, rtc.second);
-        break;
 
-    case RTCSelect::DATE:
         switch (g_config.date_format)
         {
         default:
         case FormatDate::YYMMDD:
-            snprintf_P(s, DISPLAY_COUNT + 1, format_string, rtc.year, c, rtc.month, c, rtc.day);
+            value[0] = rtc.year;
+            value[1] = rtc.month;
+            value[2] = rtc.day;
             break;
 
         case FormatDate::MMDDYY:
-            snprintf_P(s, DISPLAY_COUNT + 1, format_string, rtc.month, c, rtc.day, c, rtc.year);
+            value[0] = rtc.month;
+            value[1] = rtc.day;
+            value[2] = rtc.year;
             break;
 
         case FormatDate::DDMMYY:
-            snprintf_P(s, DISPLAY_COUNT + 1, format_string, rtc.day, c, rtc.month, c, rtc.year);
+            value[0] = rtc.day;
+            value[1] = rtc.month;
+            value[2] = rtc.year;
             break;
         }
-
-        break;
     }
+
+    // Pairs from table in place of snprintf
+    FormatPair(&s[0], value[0]);
+    s[2] = c;
+    FormatPair(&s[3], value[1]);
+    s[5] = c;
+    FormatPair(&s[6], value[2]);
+    s[8] = '\0';
 }
 
 
@@ -632,6 +736,76 @@ uint32_t GetSeconds(const uint8_t hour, const uint8_t minute, const uint8_t seco
 }
 
 
+// Light tubes with the last known display before the full Config is read
+void BootDisplay(void)
+{
+    CDisplay::Brightness brightness = CDisplay::Brightness::L4;
+    const uint8_t* address = reinterpret_cast<const uint8_t*>(EEPROM_CONFIG);
+
+    // Decode only the fields needed for display
+    if (eeprom_read_byte(address + offsetof(Config, validate)) == CONFIG_KEY)
+    {
+        uint8_t value = eeprom_read_byte(address + offsetof(Config, brightness));
+
+        // Photodiode history is not yet available for AUTO
+        if (value != getValue(CDisplay::Brightness::AUTO))
+        {
+            brightness = static_cast<CDisplay::Brightness>(value);
+        }
+    }
+
+    g_display.SetDisplayBrightness(brightness);
+    InterruptSpeed(INTERRUPT_FAST);
+
+    if (IsCacheValid(g_display_cache))
+    {
+        char s[DISPLAY_COUNT + 1];
+        memcpy(s, g_display_cache.value, DISPLAY_COUNT);
+        s[DISPLAY_COUNT] = '\0';
+        g_display.SetDisplayValue(s);
+        DisplayState(State::ENABLE);
+        g_boot_trace[BOOT_DISPLAY] = micros();
+    }
+}
+
+
+void CacheDisplay(const char* s)
+{
+    memcpy(g_display_cache.value, s, DISPLAY_COUNT);
+    g_display_cache.check = GetCacheCheck(g_display_cache);
+}
+
+
+uint16_t GetCacheCheck(const DisplayCacheStruct& cache)
+{
+    uint16_t check = CONFIG_KEY; // Seed so zeroed SRAM does not match
+
+    for (uint8_t index = 0; index < DISPLAY_COUNT; index++)
+    {
+        check = _crc_xmodem_update(check, cache.value[index]);
+    }
+
+    return check;
+}
+
+
+// Random SRAM after a cold boot must pass both the CRC and the character set
+bool IsCacheValid(const DisplayCacheStruct& cache)
+{
+    for (uint8_t index = 0; index < DISPLAY_COUNT; index++)
+    {
+        char c = cache.value[index];
+
+        if (!(((c >= '0') && (c <= '9')) || (c == ' ') || (c == ':') || (c == ';')))
+        {
+            return false;
+        }
+    }
+
+    return (cache.check == GetCacheCheck(cache));
+}
+
+
 CDisplay::Brightness ReadLightIntensity(void)
 {
     const uint8_t SAMPLES = 32;
@@ -677,6 +851,11 @@ CDisplay::Brightness ReadLightIntensity(void)
         previous_average = average;
     }
 
+    if (IsSolarMode(g_config.solar, SolarMode::BRIGHTNESS))
+    {
+        return static_cast<CDisplay::Brightness>(GetSolarBrightness(result, g_state.solar));
+    }
+
     return static_cast<CDisplay::Brightness>(result);
 }
 
@@ -685,35 +864,64 @@ void GetConfig(Config& config)
 {
     while (!eeprom_is_ready());
     cli();
-    eeprom_read_block((void*)&config, (void*)0, sizeof(Config));
+    eeprom_read_block((void*)&config, (void*)EEPROM_CONFIG, sizeof(Config));
     sei();
 }
 
 
 void SetConfig(const Config& config)
 {
+    TRACE_BEGIN(TRACE_CONFIG, 0);
     while (!eeprom_is_ready());
     cli();
     eeprom_update_block((const void*)&config, (void*)0, sizeof(Config));
     sei();
+    TRACE_END(TRACE_CONFIG, 0);
 }
 
 
 void VoltageState(State state)
 {
     g_state.voltage = state;
-    digitalWrite(DIGITAL_PIN_HV_ENABLE, getValue(state));
+    FastPin<DIGITAL_PIN_HV_ENABLE>::Write(getValue(state));
 }
 
 
 void DisplayState(State state)
 {
     g_state.display = state;
-    digitalWrite(DIGITAL_PIN_BLANK, getValue(state));
+
+    if (state == State::ENABLE)
+    {
+        TIMSK2 |= _BV(OCIE2A); // Resume display refresh
+    }
+    else
+    {
+        TIMSK2 &= ~_BV(OCIE2A); // Halt display refresh
+    }
+
+    FastPin<DIGITAL_PIN_BLANK>::Write(getValue(state));
     VoltageState(state);
 }
 
 
+// Crossfade changed units to new value within display refresh
+void DisplayTransition(const char* s)
+{
+    g_state.transition = State::DISABLE; // Hold ISR off while updating
+
+    for (uint8_t tube = 0; tube < DISPLAY_COUNT; tube++)
+    {
+        g_transition.from[tube] = g_display.GetUnitValue(tube);
+        g_transition.mix[tube] = ((g_transition.from[tube] == s[tube]) ? TRANSITION_STEPS : 0);
+    }
+
+    g_display.SetDisplayValue(s);
+    g_state.transition = State::ENABLE;
+    TRACE_MARK(TRACE_EFFECT, TRACE_EFFECT_TRANSITION);
+}
+
+
 void ButtonState(const State state)
 {
     if (state == State::ENABLE)
@@ -730,6 +938,69 @@ void ButtonState(const State state)
 }
 
 
+bool PowerSave(const CRTC::RTC& rtc)
+{
+    // Stay awake while input or audio is pending
+    // Timer0 halts in power-save so countdown deadlines also need the CPU
+    // USART halts too and a blanked unit must still carry the sync chain
+    if (g_button_timeout || g_audio.IsActive() || IsInputSelect() || IsCountdownActive() ||
+        (g_config.sync != SyncMode::DISABLE))
+    {
+        return false;
+    }
+
+    uint8_t remaining = 60 - rtc.second;
+    uint8_t period;
+
+    // Watchdog oscillator is imprecise - leave margin so the minute edge
+    // serviced by AutoAlarm() is always polled awake
+    if (remaining > 10)
+    {
+        period = WDTO_8S;
+    }
+    else if (remaining > 6)
+    {
+        period = WDTO_4S;
+    }
+    else if (remaining > 3)
+    {
+        period = WDTO_2S;
+    }
+    else if (remaining > 2)
+    {
+        period = WDTO_1S;
+    }
+    else
+    {
+        return false;
+    }
+
+    SnapshotDiscard(); // TWI halts in power-save and data would be stale
+    cli();
+    wdt_reset();
+    WDTCSR = _BV(WDCE) | _BV(WDE); // Timed change sequence
+    WDTCSR = _BV(WDIE) | (period & 0x07) | ((period & 0x08) ? _BV(WDP3) : 0); // Interrupt only
+    PCIFR = _BV(PCIF2); // Clear stale button edge
+    PCICR |= _BV(PCIE2); // Wake on button edge
+    set_sleep_mode(SLEEP_MODE_PWR_SAVE);
+    sleep_enable();
+    sleep_bod_disable();
+    sei();
+    sleep_cpu();
+    sleep_disable();
+    PCICR &= ~_BV(PCIE2);
+    SupervisorEnable(); // Restore watchdog reset
+    
+    // External interrupt edges are not detected while asleep
+    if (PinButtonB::IsHigh())
+    {
+        ISR_button_B();
+    }
+
+    return true;
+}
+
+
 void InterruptSpeed(const uint8_t speed)
 {
     // set compare match register for xHz increments
@@ -745,7 +1016,18 @@ bool IsInputIncrement(void)
 
 bool IsInputSelect(void)
 {
-    return (digitalRead(BUTTON_A) == HIGH);
+    static bool previous_value = false;
+    bool current_value = PinButtonA::IsHigh() || IsInjectSelect();
+
+    // Prompt handles a press - polling alone is not progress
+    if (current_value && !previous_value)
+    {
+        SupervisorCheckIn(TASK_LOOP);
+        InjectConsume(INJECT_BUTTON_A);
+    }
+
+    previous_value = current_value;
+    return current_value;
 }
 
 
@@ -753,12 +1035,20 @@ bool IsInputUpdate(void)
 {
     bool current_value = g_button_update;
     g_button_update = false; // Reset
+
+    if (current_value)
+    {
+        SupervisorCheckIn(TASK_LOOP); // Prompt handles a press
+        InjectConsume(INJECT_BUTTON_B);
+    }
+
     return current_value;
 }
 
 
 void ISR_button_A(void)
 {
+    TRACE_MARK(TRACE_BUTTON, 0);
     g_button_timeout_A = 75; // Debounce milliseconds
 }
 
@@ -774,6 +1064,7 @@ void ISR_button_B(void)
         }
         
         g_button_update = true; // Update only after idle
+        TRACE_MARK(TRACE_BUTTON, 1);
     }
     
     g_button_timeout_B = 75; // Debounce milliseconds
@@ -784,15 +1075,18 @@ void ISR_button_B(void)
 ISR(TIMER0_COMPA_vect) 
 {
     static bool initial = true;
-    wdt_reset(); // Reset watchdog timer
+    TRACE_BEGIN(TRACE_TICK_ISR, 0);
+    SupervisorService(); // Reset watchdog timer when tasks are alive
+    SyncTick();
+    InjectTick();
     
     // Decrement button timeout when button is low
-    if ((g_button_timeout_A > 0) && (digitalRead(BUTTON_A) == LOW))
+    if ((g_button_timeout_A > 0) && !PinButtonA::IsHigh())
     {
         g_button_timeout_A--;
     }
     
-    if (digitalRead(BUTTON_B) == HIGH)
+    if (PinButtonB::IsHigh())
     {
         g_button_timeout_B--;
         
@@ -825,14 +1119,23 @@ ISR(TIMER0_COMPA_vect)
         
         initial = true; // Reset
     }
+
+    TRACE_END(TRACE_TICK_ISR, 0);
 }
 
 
+// Wake from power-save sleep - WDT_vect is handled by supervisor
+EMPTY_INTERRUPT(PCINT2_vect);
+
+
 ISR(TIMER2_COMPA_vect)
 {
     static uint8_t pwm_cycle = 0;
+    static uint8_t mix_cycle = 0;
+    static uint8_t transition_frame = 0;
     static const uint8_t toggle[] = {0xFF, 0x01, 0x11, 0x25, 0x55, 0x5B, 0x77, 0x7F, 0xFF};
-    static const uint8_t pinout[12] = {10, 1, 2, 6, 7, 8, 9, 4, 5, 3, 0, 11};
+    static const uint8_t mix[] = {0x00, 0x01, 0x11, 0x25, 0x55, 0x5B, 0x77, 0x7F, 0xFF};
+    uint8_t start = TCNT0; // Profile including nested interrupts
 
     sei(); // Enable interrupts for audio processing
     
@@ -842,16 +1145,44 @@ ISR(TIMER2_COMPA_vect)
         return;
     }
 
+    SupervisorCheckIn(TASK_DISPLAY);
+    TRACE_BEGIN(TRACE_DISPLAY_ISR, pwm_cycle);
     pwm_cycle++;
 
     if (pwm_cycle > 7)
     {
         pwm_cycle = 0;
+        g_display_frame++;
+
+        // Step crossfade once per frame group
+        if ((g_state.transition == State::ENABLE) && (++transition_frame >= TRANSITION_FRAMES))
+        {
+            bool active = false;
+            transition_frame = 0;
+
+            for (uint8_t tube = 0; tube < DISPLAY_COUNT; tube++)
+            {
+                if (g_transition.mix[tube] < TRANSITION_STEPS)
+                {
+                    g_transition.mix[tube]++;
+                    active = true;
+                }
+            }
+
+            if (!active)
+            {
+                g_state.transition = State::DISABLE;
+            }
+        }
     }
 
-    setPinLow(DIGITAL_PIN_LATCH); // latch
+    // Rotate mix against brightness each frame - a tube lit for few phases
+    // still samples every mix bit over consecutive frames
+    mix_cycle = (pwm_cycle + g_display_frame) & 0x7;
+    FastPin<DIGITAL_PIN_LATCH>::SetLow(); // latch
 
-    for (uint8_t tube = 0; tube < DISPLAY_COUNT; tube++)
+    // Expanded per tube with constant index - no runtime shift loop
+    TubeDriver::Refresh([](const uint8_t tube) -> uint16_t
     {
         uint16_t digit_bitmap = 0;
 
@@ -859,43 +1190,59 @@ ISR(TIMER2_COMPA_vect)
         {
             uint8_t unit = g_display.GetUnitValue(tube) - '0';
             uint8_t indicator = g_display.GetUnitIndicator(tube);
+
+            // Select frame for this phase while fading
+            if ((g_state.transition == State::ENABLE) &&
+                !((mix[g_transition.mix[tube]] >> mix_cycle) & 0x1))
+            {
+                unit = g_transition.from[tube] - '0';
+            }
             
-            if (unit < sizeof(pinout))
+            if (unit < TubeDriver::PIN_COUNT)
             {
-                digit_bitmap = (1 << pinout[unit]) | indicator;
+                digit_bitmap = (1 << TubeDriver::GetPin(unit)) | indicator;
+
+                if (unit < CATHODE_COUNT)
+                {
+                    CathodeTick(tube, unit); // Lit time accounting
+                }
             }
             else
             {
-                if (unit == sizeof(pinout))
+                if (unit == TubeDriver::PIN_COUNT)
                 {
                     digit_bitmap = 0xFF; // Connect all anodes
                 }
             }
         }
 
-        for (uint8_t index = 0; index < sizeof(pinout); index++)
-        {
-            setPinHigh(DIGITAL_PIN_CLOCK); // clock
+        return digit_bitmap;
+    });
 
-            if ((digit_bitmap >> index) & 0x1)
-            {
-                setPinHigh(DIGITAL_PIN_SDATA); // sdata
-            }
-            else
-            {
-                setPinLow(DIGITAL_PIN_SDATA); // sdata
-            }
+    FastPin<DIGITAL_PIN_LATCH>::SetHigh(); // latch
 
-            setPinLow(DIGITAL_PIN_CLOCK); // clock
-        }
+    uint8_t elapsed = TCNT0 - start;
+    g_profile.last = elapsed;
+
+    if (elapsed > g_profile.maximum)
+    {
+        g_profile.maximum = elapsed;
+    }
+
+    if (elapsed > PROFILE_BUDGET)
+    {
+        g_profile.overrun++;
     }
 
-    setPinHigh(DIGITAL_PIN_LATCH); // latch
+    InjectFrame(); // After shift so latency includes this refresh
+    TRACE_END(TRACE_DISPLAY_ISR, elapsed);
 }
 
 
 void setup(void)
 {
+    g_boot_trace[BOOT_SETUP] = micros();
+    
     pinMode(DIGITAL_PIN_CLOCK, OUTPUT);         // Clock
     pinMode(DIGITAL_PIN_SDATA, OUTPUT);         // Serial Data
     pinMode(DIGITAL_PIN_LATCH, OUTPUT);         // Latch Enable
@@ -910,9 +1257,13 @@ void setup(void)
     
     // Attach button hardware interrupts
     ButtonState(State::ENABLE);
+    PCMSK2 |= _BV(PCINT18) | _BV(PCINT19); // Button wake mask
+    
+    // Serial telemetry
+    TelemetryInitialize();
     
     // Watchdog timer
-    wdt_enable(WDTO_1S); // Set for 1 second
+    SupervisorEnable(); // Set for 1 second
     
     // Millisecond timer
     OCR0A = 0x7D;
@@ -926,4 +1277,7 @@ void setup(void)
     TCCR2A |= _BV(WGM21); // Enable CTC mode
     TCCR2B |= _BV(CS22) | _BV(CS21) | _BV(CS20); // Set for 1024 prescaler
     TIMSK2 |= _BV(OCIE2A); // Enable timer compare interrupt
+
+    // Shorten time to first digit after a reset
+    BootDisplay();
 }
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Cathode.cpp
+ * @summary     Cathode lit time accounting for B5441 Nixie display tubes
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#include "Cathode.h"
+
+extern StateStruct g_state;         // struct
+extern Config g_config;             // struct
+extern CDisplay g_display;          // class
+
+CathodeStruct g_cathode[DISPLAY_COUNT];
+static CathodeExerciseStruct g_exercise;
+
+
+static uint32_t* GetCathodeAddress(const uint8_t tube, const uint8_t digit)
+{
+    return reinterpret_cast<uint32_t*>(EEPROM_CATHODE) + ((tube * CATHODE_COUNT) + digit);
+}
+
+
+uint32_t GetCathodeUnits(const uint8_t tube, const uint8_t digit)
+{
+    while (!eeprom_is_ready());
+    return eeprom_read_dword(GetCathodeAddress(tube, digit)) + g_cathode[tube].pending[digit];
+}
+
+
+// Return least used digit of tube and its deficit to the most used digit
+uint8_t SelectCathode(const uint8_t tube, uint32_t& deficit)
+{
+    uint32_t minimum = UINT32_MAX;
+    uint32_t maximum = 0;
+    uint8_t selection = 0;
+
+    for (uint8_t digit = 0; digit < CATHODE_COUNT; digit++)
+    {
+        uint32_t units = GetCathodeUnits(tube, digit);
+
+        if (units < minimum)
+        {
+            minimum = units;
+            selection = digit;
+        }
+
+        if (units > maximum)
+        {
+            maximum = units;
+        }
+    }
+
+    deficit = maximum - minimum;
+    return selection;
+}
+
+
+void CathodePersist(const bool force)
+{
+    if (!force)
+    {
+        bool limit = false;
+
+        for (uint8_t tube = 0; tube < DISPLAY_COUNT; tube++)
+        {
+            for (uint8_t digit = 0; digit < CATHODE_COUNT; digit++)
+            {
+                limit |= (g_cathode[tube].pending[digit] >= CATHODE_PENDING_LIMIT);
+            }
+        }
+
+        // Batch writes to limit EEPROM wear
+        if (!limit)
+        {
+            return;
+        }
+    }
+
+    for (uint8_t tube = 0; tube < DISPLAY_COUNT; tube++)
+    {
+        for (uint8_t digit = 0; digit < CATHODE_COUNT; digit++)
+        {
+            volatile uint8_t& count = g_cathode[tube].pending[digit];
+            uint8_t pending = count; // Single byte - atomic
+
+            if (pending)
+            {
+                uint32_t* address = GetCathodeAddress(tube, digit);
+                while (!eeprom_is_ready());
+                eeprom_update_dword(address, eeprom_read_dword(address) + pending);
+                cli();
+                count -= pending; // Retain units counted meanwhile
+                sei();
+            }
+        }
+    }
+}
+
+
+// Show least used cathode of each tube for one round
+static void CathodeRound(void)
+{
+    char s[DISPLAY_COUNT + 1];
+    uint32_t deficit;
+
+    // Reselect each round as accounting credits the lit cathodes
+    for (uint8_t tube = 0; tube < DISPLAY_COUNT; tube++)
+    {
+        uint8_t digit = SelectCathode(tube, deficit);
+        s[tube] = (deficit < CATHODE_DEFICIT_MIN) ? ' ' : ('0' + digit);
+    }
+
+    s[DISPLAY_COUNT] = '\0';
+    g_display.SetDisplayValue(s);
+    g_exercise.seconds = CATHODE_ROUND_SECONDS;
+}
+
+
+// Light the least used cathode of each tube while the display is blanked
+void CathodeExerciseStart(void)
+{
+    uint32_t deficit;
+    uint32_t deficit_max = 0;
+
+    for (uint8_t tube = 0; tube < DISPLAY_COUNT; tube++)
+    {
+        SelectCathode(tube, deficit);
+        deficit_max = (deficit > deficit_max) ? deficit : deficit_max;
+    }
+
+    if (deficit_max < CATHODE_DEFICIT_MIN)
+    {
+        return; // Wear is even
+    }
+
+    // Size session from the measured deficit
+    const uint8_t round_units = (CATHODE_ROUND_SECONDS / CATHODE_UNIT_SECONDS);
+    uint32_t rounds = (deficit_max + round_units - 1) / round_units;
+
+    if (rounds > CATHODE_ROUND_LIMIT)
+    {
+        rounds = CATHODE_ROUND_LIMIT;
+    }
+
+    g_exercise.rounds = rounds - 1;
+    g_display.SetDisplayIndicator(false);
+    g_display.SetDisplayBrightness(CDisplay::Brightness::MAX);
+    CathodeRound();
+    DisplayState(State::ENABLE);
+}
+
+
+// Called once per second from main loop - one round is reselected at most
+void CathodeExerciseStep(void)
+{
+    if (!g_exercise.seconds || --g_exercise.seconds)
+    {
+        return;
+    }
+
+    if (g_exercise.rounds)
+    {
+        g_exercise.rounds--;
+        CathodeRound();
+        return;
+    }
+
+    CathodeExerciseStop();
+    DisplayState(State::DISABLE);
+}
+
+
+// End session early - caller decides display state
+void CathodeExerciseStop(void)
+{
+    if (g_exercise.seconds)
+    {
+        g_exercise.seconds = 0;
+        g_exercise.rounds = 0;
+        g_display.SetDisplayBrightness(g_config.brightness);
+    }
+}
+
+
+bool IsCathodeExercise(void)
+{
+    return g_exercise.seconds;
+}
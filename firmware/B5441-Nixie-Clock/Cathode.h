@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Cathode.h
+ * @summary     Cathode lit time accounting for B5441 Nixie display tubes
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#ifndef _CATHODE_H
+#define _CATHODE_H
+
+#include "B5441-Nixie-Clock.h"
+
+const uint8_t CATHODE_COUNT = 10; // Numeric cathodes 0-9
+const uint8_t CATHODE_UNIT_SECONDS = 16; // Seconds lit at full brightness per unit
+const uint16_t CATHODE_UNITS_PER_HOUR = (3600 / CATHODE_UNIT_SECONDS);
+const uint16_t CATHODE_TICKS_PER_UNIT = (F_CPU / 1024 / (INTERRUPT_FAST + 1)) * CATHODE_UNIT_SECONDS;
+const uint8_t CATHODE_PENDING_LIMIT = 225; // Persist after ~1 hour of lit time
+const uint16_t CATHODE_DEFICIT_MIN = CATHODE_UNITS_PER_HOUR; // Ignore smaller deficits
+const uint8_t CATHODE_ROUND_SECONDS = 64; // Exercise duration per round
+const uint8_t CATHODE_ROUND_LIMIT = 15; // Maximum rounds per session
+
+const uint8_t CATHODE_JITTER = 128; // Mean of TCNT0 added to sample interval
+
+// One tick counter per tube - each unit of lit time is credited to the
+// digit lit when it ends, which samples the tube without bias over hours
+struct CathodeStruct
+{
+    uint16_t            ticks;                      // Lit phases to next sample (ISR only)
+    volatile uint8_t    pending[CATHODE_COUNT];     // Units not yet written to EEPROM
+};
+
+struct CathodeExerciseStruct
+{
+    uint8_t     rounds;     // Rounds after current one
+    uint8_t     seconds;    // Seconds left in current round, 0 when idle
+};
+
+extern CathodeStruct g_cathode[DISPLAY_COUNT];
+
+// Called from display refresh for every lit phase
+inline void CathodeTick(const uint8_t tube, const uint8_t digit)
+{
+    CathodeStruct& cathode = g_cathode[tube];
+
+    if (!cathode.ticks--)
+    {
+        // Jitter keeps regular digit changes from locking to the samples
+        cathode.ticks = (CATHODE_TICKS_PER_UNIT - CATHODE_JITTER) + TCNT0;
+
+        if (cathode.pending[digit] != 0xFF)
+        {
+            cathode.pending[digit]++;
+        }
+    }
+}
+
+uint32_t GetCathodeUnits(const uint8_t tube, const uint8_t digit);
+uint8_t SelectCathode(const uint8_t tube, uint32_t& deficit);
+void CathodePersist(const bool force);
+void CathodeExerciseStart(void);
+void CathodeExerciseStep(void);
+void CathodeExerciseStop(void);
+bool IsCathodeExercise(void);
+
+#endif
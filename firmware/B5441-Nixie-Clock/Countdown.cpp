@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Countdown.cpp
+ * @summary     Background countdown timers for B5441 Nixie clock
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#include "Countdown.h"
+#include "Label.h"
+
+extern Config g_config;             // struct
+
+CountdownStruct g_countdown[COUNTDOWN_COUNT];
+
+
+// Return index of started timer or -1 if all are in use
+int8_t CountdownStart(const uint32_t seconds)
+{
+    for (uint8_t index = 0; index < COUNTDOWN_COUNT; index++)
+    {
+        if (!g_countdown[index].active)
+        {
+            g_countdown[index].deadline = millis() + (seconds * 1000);
+            g_countdown[index].active = true;
+            return index;
+        }
+    }
+
+    return -1;
+}
+
+
+void CountdownCancel(const uint8_t index)
+{
+    g_countdown[index].active = false;
+}
+
+
+bool IsCountdownActive(void)
+{
+    for (uint8_t index = 0; index < COUNTDOWN_COUNT; index++)
+    {
+        if (g_countdown[index].active)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+bool IsCountdownActive(const uint8_t index)
+{
+    return g_countdown[index].active;
+}
+
+
+// Remaining seconds rounded up so zero is only shown at expiry
+uint32_t GetCountdownRemaining(const uint8_t index)
+{
+    int32_t remaining = g_countdown[index].deadline - millis();
+
+    if (!g_countdown[index].active || (remaining <= 0))
+    {
+        return 0;
+    }
+
+    return (remaining + 999) / 1000;
+}
+
+
+bool AutoCountdown(void)
+{
+    uint32_t current_time = millis();
+
+    for (uint8_t index = 0; index < COUNTDOWN_COUNT; index++)
+    {
+        // Signed difference survives millis() rollover
+        if (g_countdown[index].active &&
+            (static_cast<int32_t>(current_time - g_countdown[index].deadline) >= 0))
+        {
+            g_countdown[index].active = false;
+            PlayAlarm(g_config.music_timer, GetLabel(LABEL_ZERO));
+            return true; // Remaining timers are serviced on next call
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Countdown.h
+ * @summary     Background countdown timers for B5441 Nixie clock
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#ifndef _COUNTDOWN_H
+#define _COUNTDOWN_H
+
+#include "B5441-Nixie-Clock.h"
+
+const uint8_t COUNTDOWN_COUNT = 3; // Concurrent timers
+
+struct CountdownStruct
+{
+    uint32_t    deadline;   // millis() at expiry
+    bool        active;
+};
+
+int8_t CountdownStart(const uint32_t seconds);
+void CountdownCancel(const uint8_t index);
+bool IsCountdownActive(void);
+bool IsCountdownActive(const uint8_t index);
+uint32_t GetCountdownRemaining(const uint8_t index);
+bool AutoCountdown(void);
+
+#endif
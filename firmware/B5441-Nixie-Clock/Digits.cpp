@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Digits.cpp
+ * @summary     Table-driven decimal conversion for B5441 Nixie display
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#include "Digits.h"
+#include "Telemetry.h"
+
+extern CDisplay g_display;          // class
+
+// Character pairs 00 to 99
+const char digit_pair[] PROGMEM =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+
+// Zero padded low DISPLAY_COUNT digits as the library renders integers
+// One 32-bit divide per four digits - pairs come from the table
+void FormatDigits(char* s, uint32_t value)
+{
+    uint8_t position = DISPLAY_COUNT;
+    s[position] = '\0';
+
+    while (position >= 4)
+    {
+        uint32_t quotient = (value < 10000) ? 0 : (value / 10000);
+        uint16_t group = value - (quotient * 10000);
+        uint8_t high = (group * 5243UL) >> 19; // group / 100 below 43699
+        position -= 4;
+        FormatPair(&s[position], high);
+        FormatPair(&s[position + 2], group - (high * 100));
+        value = quotient;
+    }
+
+    if (position >= 2)
+    {
+        position -= 2;
+        FormatPair(&s[position], (value < 100) ? value : (value % 100));
+        value = (value < 100) ? 0 : (value / 100);
+    }
+
+    if (position)
+    {
+        s[0] = '0' + (value % 10);
+    }
+}
+
+
+// Cycles per call of library and table conversion with interrupts held off
+void DigitsBenchmark(void)
+{
+    static const uint32_t sample[] = {0, 99999, 12345678};
+    char s[DISPLAY_COUNT + 1];
+    char restore[DISPLAY_COUNT + 1];
+
+    g_display.GetDisplayValue(restore);
+
+    for (uint8_t index = 0; index < (sizeof(sample) / sizeof(sample[0])); index++)
+    {
+        uint16_t library = 0;
+        uint16_t table = 0;
+
+        for (uint8_t pass = 0; pass < DIGITS_BENCHMARK_PASSES; pass++)
+        {
+            cli();
+            uint8_t start = TCNT0;
+            g_display.SetDisplayValue(sample[index]);
+            uint8_t middle = TCNT0;
+            FormatDigits(s, sample[index]);
+            g_display.SetDisplayValue(s);
+            uint8_t end = TCNT0;
+            sei();
+
+            library += static_cast<uint8_t>(middle - start);
+            table += static_cast<uint8_t>(end - middle);
+        }
+
+        TelemetryPrint(PSTR("N value=%lu library=%u table=%u\r\n"), sample[index],
+                       library * (DIGITS_CYCLES_PER_TICK / DIGITS_BENCHMARK_PASSES),
+                       table * (DIGITS_CYCLES_PER_TICK / DIGITS_BENCHMARK_PASSES));
+    }
+
+    g_display.SetDisplayValue(restore);
+}
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Digits.h
+ * @summary     Table-driven decimal conversion for B5441 Nixie display
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#ifndef _DIGITS_H
+#define _DIGITS_H
+
+#include "B5441-Nixie-Clock.h"
+
+const uint8_t DIGITS_BENCHMARK_PASSES = 16;
+const uint8_t DIGITS_CYCLES_PER_TICK = 64; // Timer0 prescaler
+
+extern const char digit_pair[] PROGMEM;
+
+// Two characters of value below 100
+inline void FormatPair(char* s, const uint8_t value)
+{
+    memcpy_P(s, &digit_pair[value * 2], 2);
+}
+
+void FormatDigits(char* s, uint32_t value);
+void DigitsBenchmark(void);
+
+#endif
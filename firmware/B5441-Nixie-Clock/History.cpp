@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        History.cpp
+ * @summary     Temperature history log for B5441 Nixie clock
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#include <stddef.h>
+#include "History.h"
+#include "Telemetry.h"
+
+// Days before first of each month in a common year
+static const uint16_t month_days[12] PROGMEM = {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
+
+static HistoryHeader g_header;
+static int16_t g_pending[HISTORY_BATCH]; // Absolute values not yet written
+static uint32_t g_pending_stamp[HISTORY_BATCH];
+static uint8_t g_pending_count = 0;
+
+
+static HistoryLayout* GetLayout(void)
+{
+    return reinterpret_cast<HistoryLayout*>(EEPROM_HISTORY);
+}
+
+
+static void ReadBucket(HistoryBucket* address, HistoryBucket& bucket)
+{
+    eeprom_read_block(&bucket, address, sizeof(HistoryBucket));
+}
+
+
+static void WriteBucket(HistoryBucket* address, const HistoryBucket& bucket)
+{
+    eeprom_update_block(&bucket, address, sizeof(HistoryBucket));
+}
+
+
+// Fold sample into bucket restarting it when a new period begins
+static void MergeSample(HistoryBucket& bucket, const uint32_t stamp, const uint8_t hours, const int16_t value)
+{
+    if ((bucket.count == 0) || ((bucket.stamp / hours) != (stamp / hours)))
+    {
+        bucket.minimum = value;
+        bucket.maximum = value;
+        bucket.sum = 0;
+        bucket.count = 0;
+    }
+
+    bucket.stamp = stamp;
+    bucket.minimum = min(bucket.minimum, value);
+    bucket.maximum = max(bucket.maximum, value);
+    bucket.sum += value;
+    bucket.count++;
+}
+
+
+// Hours elapsed since 2000-01-01
+uint32_t GetHourStamp(const CRTC::RTC& rtc)
+{
+    uint16_t days = (rtc.year * 365) + ((rtc.year + 3) / 4);
+    days += pgm_read_word(&month_days[rtc.month - 1]) + (rtc.day - 1);
+
+    if (((rtc.year % 4) == 0) && (rtc.month > 2))
+    {
+        days++; // Leap day of current year
+    }
+
+    return (static_cast<uint32_t>(days) * 24) + rtc.hour;
+}
+
+
+void HistoryInitialize(void)
+{
+    eeprom_read_block(&g_header, &GetLayout()->header, sizeof(HistoryHeader));
+
+    if (g_header.validate != HISTORY_KEY)
+    {
+        HistoryBucket bucket = {0, 0, 0, 0, 0};
+
+        g_header.validate = HISTORY_KEY;
+        g_header.head = 0;
+        g_header.count = 0;
+        g_header.last = 0;
+        g_header.stamp = 0;
+
+        for (uint8_t index = 0; index < HISTORY_BLOCK_COUNT; index++)
+        {
+            WriteBucket(&GetLayout()->block[index], bucket);
+        }
+
+        for (uint8_t index = 0; index < HISTORY_DAY_COUNT; index++)
+        {
+            WriteBucket(&GetLayout()->day[index], bucket);
+        }
+
+        eeprom_update_block(&g_header, &GetLayout()->header, sizeof(HistoryHeader));
+    }
+}
+
+
+void HistorySample(const uint32_t stamp, const int16_t value)
+{
+    g_pending[g_pending_count] = value;
+    g_pending_stamp[g_pending_count] = stamp;
+
+    if (++g_pending_count >= HISTORY_BATCH)
+    {
+        HistoryFlush();
+    }
+}
+
+
+// Write buffered samples and their summaries in one batch
+void HistoryFlush(void)
+{
+    HistoryLayout* layout = GetLayout();
+
+    for (uint8_t index = 0; index < g_pending_count; index++)
+    {
+        int16_t value = g_pending[index];
+        uint32_t stamp = g_pending_stamp[index];
+        int16_t delta = (g_header.count ? (value - g_header.last) : 0);
+        HistoryBucket bucket;
+
+        // Clamp and keep chain consistent with what is stored
+        delta = constrain(delta, INT8_MIN, INT8_MAX);
+        value = (g_header.count ? (g_header.last + delta) : value);
+
+        eeprom_update_byte(reinterpret_cast<uint8_t*>(&layout->delta[g_header.head]), delta);
+
+        if (++g_header.head >= HISTORY_SAMPLE_COUNT)
+        {
+            g_header.head = 0;
+        }
+
+        if (g_header.count < HISTORY_SAMPLE_COUNT)
+        {
+            g_header.count++;
+        }
+
+        g_header.last = value;
+        g_header.stamp = stamp;
+
+        HistoryBucket* address = &layout->block[(stamp / HISTORY_BLOCK_HOURS) % HISTORY_BLOCK_COUNT];
+        ReadBucket(address, bucket);
+        MergeSample(bucket, stamp, HISTORY_BLOCK_HOURS, value);
+        WriteBucket(address, bucket);
+
+        address = &layout->day[(stamp / 24) % HISTORY_DAY_COUNT];
+        ReadBucket(address, bucket);
+        MergeSample(bucket, stamp, 24, value);
+        WriteBucket(address, bucket);
+    }
+
+    g_pending_count = 0;
+    eeprom_update_block(&g_header, &layout->header, sizeof(HistoryHeader));
+}
+
+
+// Combine summaries within window - pending samples are included
+bool GetHistorySummary(const HistoryWindow window, const uint32_t stamp, HistorySummary& summary)
+{
+    HistoryBucket* address;
+    uint8_t bucket_count;
+    uint8_t hours;
+    uint8_t limit;
+    int32_t sum = 0;
+    uint16_t count = 0;
+
+    if (window == HistoryWindow::DAY)
+    {
+        address = GetLayout()->block;
+        bucket_count = HISTORY_BLOCK_COUNT;
+        hours = HISTORY_BLOCK_HOURS;
+        limit = HISTORY_BLOCK_COUNT;
+    }
+    else
+    {
+        address = GetLayout()->day;
+        bucket_count = HISTORY_DAY_COUNT;
+        hours = 24;
+        limit = HISTORY_DAY_COUNT;
+    }
+
+    summary.minimum = INT16_MAX;
+    summary.maximum = INT16_MIN;
+
+    for (uint8_t index = 0; index < bucket_count; index++)
+    {
+        HistoryBucket bucket;
+        ReadBucket(&address[index], bucket);
+
+        // Skip empty buckets and periods older than window
+        if (bucket.count && (((stamp / hours) - (bucket.stamp / hours)) < limit))
+        {
+            summary.minimum = min(summary.minimum, bucket.minimum);
+            summary.maximum = max(summary.maximum, bucket.maximum);
+            sum += bucket.sum;
+            count += bucket.count;
+        }
+    }
+
+    for (uint8_t index = 0; index < g_pending_count; index++)
+    {
+        if (((stamp / hours) - (g_pending_stamp[index] / hours)) < limit)
+        {
+            summary.minimum = min(summary.minimum, g_pending[index]);
+            summary.maximum = max(summary.maximum, g_pending[index]);
+            sum += g_pending[index];
+            count++;
+        }
+    }
+
+    if (!count)
+    {
+        return false;
+    }
+
+    summary.average = (sum / count);
+    summary.count = count;
+    return true;
+}
+
+
+// Stream stored samples newest first in quarter degrees Celsius
+void HistoryExport(void)
+{
+    HistoryFlush(); // Include pending samples
+
+    int16_t value = g_header.last;
+    uint8_t slot = g_header.head;
+
+    TelemetryPrint(PSTR("H count=%u stamp=%lu\r\n"), g_header.count, g_header.stamp);
+
+    for (uint8_t age = 0; age < g_header.count; age++)
+    {
+        slot = (slot ? slot : HISTORY_SAMPLE_COUNT) - 1;
+        TelemetryPrint(PSTR("%u %d\r\n"), age, value);
+        value -= static_cast<int8_t>(eeprom_read_byte(reinterpret_cast<uint8_t*>(&GetLayout()->delta[slot])));
+    }
+
+    for (uint8_t window = 0; window < 2; window++)
+    {
+        HistorySummary summary;
+
+        if (GetHistorySummary(static_cast<HistoryWindow>(window), g_header.stamp, summary))
+        {
+            TelemetryPrint(PSTR("S%u min=%d max=%d avg=%d n=%u\r\n"), window,
+                           summary.minimum, summary.maximum, summary.average, summary.count);
+        }
+    }
+}
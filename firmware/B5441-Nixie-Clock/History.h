@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        History.h
+ * @summary     Temperature history log for B5441 Nixie clock
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#ifndef _HISTORY_H
+#define _HISTORY_H
+
+#include "B5441-Nixie-Clock.h"
+
+const uint8_t HISTORY_KEY = 0xA5; // Change when layout changes
+const uint8_t HISTORY_SAMPLE_COUNT = 168; // One week of hourly samples
+const uint8_t HISTORY_BATCH = 4; // Samples buffered per EEPROM write
+const uint8_t HISTORY_BLOCK_HOURS = 4;
+const uint8_t HISTORY_BLOCK_COUNT = (24 / HISTORY_BLOCK_HOURS);
+const uint8_t HISTORY_DAY_COUNT = 7;
+
+enum class HistoryWindow : uint8_t
+{
+    DAY,    // Last 24 hours
+    WEEK,   // Last 7 days
+};
+
+// Running summary of samples in quarter degrees Celsius
+struct HistoryBucket
+{
+    uint32_t    stamp;      // Hour of most recent sample
+    int16_t     minimum;
+    int16_t     maximum;
+    int16_t     sum;
+    uint8_t     count;
+};
+
+struct HistoryHeader
+{
+    uint8_t     validate;
+    uint8_t     head;       // Next sample slot
+    uint8_t     count;      // Samples stored
+    int16_t     last;       // Absolute value of newest sample
+    uint32_t    stamp;      // Hour of newest sample
+};
+
+struct HistoryLayout
+{
+    HistoryHeader   header;
+    HistoryBucket   block[HISTORY_BLOCK_COUNT];
+    HistoryBucket   day[HISTORY_DAY_COUNT];
+    int8_t          delta[HISTORY_SAMPLE_COUNT]; // Change from previous sample
+};
+
+struct HistorySummary
+{
+    int16_t     minimum;
+    int16_t     maximum;
+    int16_t     average;
+    uint8_t     count;
+};
+
+uint32_t GetHourStamp(const CRTC::RTC& rtc);
+void HistoryInitialize(void);
+void HistorySample(const uint32_t stamp, const int16_t value);
+void HistoryFlush(void);
+bool GetHistorySummary(const HistoryWindow window, const uint32_t stamp, HistorySummary& summary);
+void HistoryExport(void);
+
+#endif
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Inject.cpp
+ * @summary     Serial button injection and UI latency capture for B5441 Nixie clock
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#include "Inject.h"
+#include "Telemetry.h"
+
+extern CDisplay g_display;          // class
+extern volatile bool g_button_update;
+
+InjectStruct g_inject;
+
+static void InjectRecord(const uint16_t value);
+
+
+// Called from UART receive interrupt - returns true when byte was consumed
+bool InjectReceive(const uint8_t data)
+{
+    if ((data != INJECT_BUTTON_A) && (data != INJECT_BUTTON_B))
+    {
+        return false;
+    }
+
+    if (g_inject.pending)
+    {
+        InjectRecord(INJECT_NO_CHANGE);
+    }
+
+    g_inject.button = data;
+    g_inject.start = micros();
+    g_inject.consumed = false;
+    g_inject.pending = true;
+
+    if (data == INJECT_BUTTON_A)
+    {
+        g_inject.hold = INJECT_HOLD_MS; // Level read by IsInputSelect()
+    }
+    else
+    {
+        g_button_update = true; // As ISR_button_B after debounce
+    }
+
+    return true;
+}
+
+
+// Called every millisecond
+void InjectTick(void)
+{
+    if (g_inject.hold)
+    {
+        g_inject.hold--;
+    }
+}
+
+
+// Called when UI reads a press - display changes before this are not a
+// response, so ticking seconds and blinking prompts cannot end a measurement
+void InjectConsume(const uint8_t button)
+{
+    uint8_t sreg = SREG;
+    cli();
+
+    if (g_inject.pending && !g_inject.consumed && (g_inject.button == button))
+    {
+        g_inject.signature = GetDisplaySignature();
+        g_inject.consumed = true;
+    }
+
+    SREG = sreg;
+}
+
+
+// Called every display refresh - first change after input is read ends measurement
+void InjectFrame(void)
+{
+    if (g_inject.consumed)
+    {
+        uint8_t sreg = SREG;
+        cli(); // Refresh runs nested - keep receive from starting another
+
+        if (g_inject.consumed && (GetDisplaySignature() != g_inject.signature))
+        {
+            uint32_t elapsed = (micros() - g_inject.start) / INJECT_UNIT_US;
+            InjectRecord(min(elapsed, static_cast<uint32_t>(INJECT_NO_CHANGE - 1)));
+        }
+
+        SREG = sreg;
+    }
+}
+
+
+void InjectExport(void)
+{
+    cli();
+    uint8_t count = g_inject.count;
+    sei();
+
+    TelemetryPrint(PSTR("L count=%u\r\n"), count);
+
+    for (uint8_t index = 0; index < count; index++)
+    {
+        uint16_t value = g_inject.result[index];
+
+        if (value == INJECT_NO_CHANGE)
+        {
+            TelemetryPrint(PSTR("-\r\n"));
+        }
+        else
+        {
+            TelemetryPrint(PSTR("%u.%u\r\n"), value / 10, value % 10); // Milliseconds
+        }
+    }
+
+    cli();
+    g_inject.count = 0;
+    sei();
+}
+
+
+// Units and indicators only - brightness changes are not a response
+uint16_t GetDisplaySignature(void)
+{
+    uint16_t signature = 0;
+
+    for (uint8_t tube = 0; tube < DISPLAY_COUNT; tube++)
+    {
+        uint8_t unit = g_display.GetUnitValue(tube) ^ (g_display.GetUnitIndicator(tube) << 7);
+        signature = ((signature << 3) | (signature >> 13)) ^ unit;
+    }
+
+    return signature;
+}
+
+
+// Interrupts must be disabled
+static void InjectRecord(const uint16_t value)
+{
+    if (g_inject.count < INJECT_RESULT_COUNT)
+    {
+        g_inject.result[g_inject.count++] = value;
+    }
+
+    g_inject.pending = false;
+    g_inject.consumed = false;
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Inject.h
+ * @summary     Serial button injection and UI latency capture for B5441 Nixie clock
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#ifndef _INJECT_H
+#define _INJECT_H
+
+#include "B5441-Nixie-Clock.h"
+
+const uint8_t INJECT_BUTTON_A = 0x0E; // ASCII SO - never a telemetry command
+const uint8_t INJECT_BUTTON_B = 0x0F; // ASCII SI
+const uint8_t INJECT_HOLD_MS = 100; // Button A held down
+const uint8_t INJECT_RESULT_COUNT = 32;
+const uint8_t INJECT_UNIT_US = 100; // Microseconds per latency unit
+const uint16_t INJECT_NO_CHANGE = 0xFFFF; // Next input arrived first
+
+struct InjectStruct
+{
+    volatile uint8_t    hold;       // Milliseconds A remains pressed
+    volatile bool       pending;    // Waiting for response to input
+    volatile bool       consumed;   // Input read by UI - next display change is response
+    uint8_t             button;     // Injected byte
+    uint16_t            signature;  // Display when input was read
+    uint32_t            start;      // micros() of input
+    uint16_t            result[INJECT_RESULT_COUNT]; // Latency in units
+    volatile uint8_t    count;
+};
+
+extern InjectStruct g_inject;
+
+bool InjectReceive(const uint8_t data);
+void InjectTick(void);
+void InjectConsume(const uint8_t button);
+void InjectFrame(void);
+void InjectExport(void);
+uint16_t GetDisplaySignature(void);
+
+inline bool IsInjectSelect(void)
+{
+    return g_inject.hold;
+}
+
+#endif
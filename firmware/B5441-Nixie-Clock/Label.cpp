@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Label.cpp
+ * @summary     Display label pool for B5441 Nixie display tubes
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#include "Label.h"
+
+const LabelStruct label_pool[LABEL_COUNT] PROGMEM =
+{
+    [LABEL_DIVERGENCE]  = MakeLabel("DIVRGNCE"),
+    [LABEL_TIMER]       = MakeLabel("TIMER"),
+    [LABEL_STOPWATCH]   = MakeLabel("STOPWTCH"),
+    [LABEL_TICKER]      = MakeLabel("TICKER"),
+    [LABEL_AUDIO]       = MakeLabel("AUDIO"),
+    [LABEL_BRIGHT]      = MakeLabel("BRIGHT"),
+    [LABEL_DISPLAY]     = MakeLabel("DISPLAY"),
+    [LABEL_ALARM]       = MakeLabel("ALARM"),
+    [LABEL_SETTINGS]    = MakeLabel("SETTINGS"),
+    [LABEL_TIME]        = MakeLabel("TIME"),
+    [LABEL_DATE]        = MakeLabel("DATE"),
+    [LABEL_PERIOD]      = MakeLabel("PERIOD"),
+    [LABEL_AM]          = MakeLabel("AM"),
+    [LABEL_PM]          = MakeLabel("PM"),
+    [LABEL_DISABLE]     = MakeLabel("DISABLE"),
+    [LABEL_ENABLE]      = MakeLabel("ENABLE"),
+    [LABEL_RESET]       = MakeLabel("RESET"),
+    [LABEL_CANCEL]      = MakeLabel("CANCEL"),
+    [LABEL_POWER_OFF]   = MakeLabel("POWR OFF"),
+    [LABEL_POWER_ON]    = MakeLabel("POWR ON"),
+    [LABEL_AUTO]        = MakeLabel("AUTO"),
+    [LABEL_SET]         = MakeLabel("SET"),
+    [LABEL_SET_1]       = MakeLabel(" SET 1"),
+    [LABEL_SET_2]       = MakeLabel(" SET 2"),
+    [LABEL_SET_3]       = MakeLabel(" SET 3"),
+    [LABEL_SET_4]       = MakeLabel(" SET 4"),
+    [LABEL_SET_5]       = MakeLabel(" SET 5"),
+    [LABEL_SET_6]       = MakeLabel(" SET 6"),
+    [LABEL_SET_7]       = MakeLabel(" SET 7"),
+    [LABEL_SET_8]       = MakeLabel(" SET 8"),
+    [LABEL_GAIN]        = MakeLabel("GAIN"),
+    [LABEL_OFFSET]      = MakeLabel("OFFSET"),
+    [LABEL_BUZZER]      = MakeLabel("BUZZER"),
+    [LABEL_HOUR]        = MakeLabel("HOUR"),
+    [LABEL_H24]         = MakeLabel(";24:"),
+    [LABEL_H12]         = MakeLabel(";12:"),
+    [LABEL_YYMMDD]      = MakeLabel("99:12:31"),
+    [LABEL_MMDDYY]      = MakeLabel("12:31:99"),
+    [LABEL_DDMMYY]      = MakeLabel("31:12:99"),
+    [LABEL_TEMP]        = MakeLabel("TEMP"),
+    [LABEL_TEMP_C]      = MakeLabel("TEMP C"),
+    [LABEL_TEMP_F]      = MakeLabel("TEMP F"),
+    [LABEL_A1_OFF]      = MakeLabel("A;1  0"),
+    [LABEL_A1_ON]       = MakeLabel("A;1  1"),
+    [LABEL_A2_OFF]      = MakeLabel("A;2  0"),
+    [LABEL_A2_ON]       = MakeLabel("A;2  1"),
+    [LABEL_A3_OFF]      = MakeLabel("A;3  0"),
+    [LABEL_A3_ON]       = MakeLabel("A;3  1"),
+    [LABEL_SUNDAY]      = MakeLabel("SUNDAY 1"),
+    [LABEL_MONDAY]      = MakeLabel("MONDAY 2"),
+    [LABEL_TUESDAY]     = MakeLabel("TUESDY 3"),
+    [LABEL_WEDNESDAY]   = MakeLabel("WDNSDY 4"),
+    [LABEL_THURSDAY]    = MakeLabel("THRSDY 5"),
+    [LABEL_FRIDAY]      = MakeLabel("FRIDAY 6"),
+    [LABEL_SATURDAY]    = MakeLabel("SATRDY 7"),
+    [LABEL_SYNC]        = MakeLabel("SYNC"),
+    [LABEL_MASTER]      = MakeLabel("MASTER"),
+    [LABEL_FOLLOWER]    = MakeLabel("FOLLOWER"),
+    [LABEL_SOLAR]       = MakeLabel("SOLAR"),
+    [LABEL_LATITUDE]    = MakeLabel("LATITUDE"),
+    [LABEL_LONGITUDE]   = MakeLabel("LONGITUD"),
+    [LABEL_DONE]        = MakeLabel("DONE"),
+    [LABEL_ZERO]        = MakeLabel("00000000"),
+    [LABEL_BLANK]       = MakeLabel(""),
+    [LABEL_ANODE]       = MakeLabel("<<<<<<<<"),
+    [LABEL_SEPARATOR]   = MakeLabel(";:;:;:;:"),
+    [LABEL_ATTRACTOR]   = MakeLabel("1.048596"),
+};
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Label.h
+ * @summary     Display label pool for B5441 Nixie display tubes
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#ifndef _LABEL_H
+#define _LABEL_H
+
+#include "B5441-Nixie-Clock.h"
+
+// Preferred character conversion
+// A B C D E F G H I J K L M N O P Q R S T U V W X Y Z
+// 4 8 6 2 3 4 6 8 1 3 8 1 0 0 0 9 2 2 5 7 0 0 3 8 9 2
+// _ _     _   _   _     _     _ _ _ _ _ _         _ _
+
+enum Label : uint8_t
+{
+    LABEL_DIVERGENCE,
+    LABEL_TIMER,
+    LABEL_STOPWATCH,
+    LABEL_TICKER,
+    LABEL_AUDIO,
+    LABEL_BRIGHT,
+    LABEL_DISPLAY,
+    LABEL_ALARM,
+    LABEL_SETTINGS,
+    LABEL_TIME,
+    LABEL_DATE,
+    LABEL_PERIOD,
+    LABEL_AM,
+    LABEL_PM,
+    LABEL_DISABLE,
+    LABEL_ENABLE,
+    LABEL_RESET,
+    LABEL_CANCEL,
+    LABEL_POWER_OFF,
+    LABEL_POWER_ON,
+    LABEL_AUTO,
+    LABEL_SET,
+    LABEL_SET_1,
+    LABEL_SET_2,
+    LABEL_SET_3,
+    LABEL_SET_4,
+    LABEL_SET_5,
+    LABEL_SET_6,
+    LABEL_SET_7,
+    LABEL_SET_8,
+    LABEL_GAIN,
+    LABEL_OFFSET,
+    LABEL_BUZZER,
+    LABEL_HOUR,
+    LABEL_H24,
+    LABEL_H12,
+    LABEL_YYMMDD,
+    LABEL_MMDDYY,
+    LABEL_DDMMYY,
+    LABEL_TEMP,
+    LABEL_TEMP_C,
+    LABEL_TEMP_F,
+    LABEL_A1_OFF,
+    LABEL_A1_ON,
+    LABEL_A2_OFF,
+    LABEL_A2_ON,
+    LABEL_A3_OFF,
+    LABEL_A3_ON,
+    LABEL_SUNDAY,
+    LABEL_MONDAY,
+    LABEL_TUESDAY,
+    LABEL_WEDNESDAY,
+    LABEL_THURSDAY,
+    LABEL_FRIDAY,
+    LABEL_SATURDAY,
+    LABEL_SYNC,
+    LABEL_MASTER,
+    LABEL_FOLLOWER,
+    LABEL_SOLAR,
+    LABEL_LATITUDE,
+    LABEL_LONGITUDE,
+    LABEL_DONE,
+    LABEL_ZERO,
+    LABEL_BLANK,
+    LABEL_ANODE,
+    LABEL_SEPARATOR,
+    LABEL_ATTRACTOR,
+    LABEL_COUNT, // Number of labels
+};
+
+struct LabelStruct
+{
+    char s[DISPLAY_COUNT + 1];
+};
+
+// Compile-time index sequence for label expansion
+template<uint8_t... I> struct LabelIndex {};
+template<uint8_t N, uint8_t... I> struct LabelSequence : LabelSequence<N - 1, N - 1, I...> {};
+template<uint8_t... I> struct LabelSequence<0, I...>
+{
+    typedef LabelIndex<I...> type;
+};
+
+constexpr char Transliterate(const char c)
+{
+    return ((c >= 'A') && (c <= 'Z')) ? "48623468138100092257003892"[c - 'A'] : c;
+}
+
+// Character at display position of centered text
+template<size_t N> constexpr char LabelChar(const char (&text)[N], const uint8_t position)
+{
+    return ((position < ((DISPLAY_COUNT - (N - 1)) / 2)) ||
+            (position >= (((DISPLAY_COUNT - (N - 1)) / 2) + (N - 1))))
+           ? ' ' : Transliterate(text[position - ((DISPLAY_COUNT - (N - 1)) / 2)]);
+}
+
+template<size_t N, uint8_t... I>
+constexpr LabelStruct MakeLabel(const char (&text)[N], LabelIndex<I...>)
+{
+    return LabelStruct{{LabelChar(text, I)..., '\0'}};
+}
+
+// Transliterate and center text to a full display width at compile time
+template<size_t N> constexpr LabelStruct MakeLabel(const char (&text)[N])
+{
+    static_assert(N <= (DISPLAY_COUNT + 1), "Label exceeds display width");
+    return MakeLabel(text, typename LabelSequence<DISPLAY_COUNT>::type());
+}
+
+// Each label is stored once in flash
+extern const LabelStruct label_pool[LABEL_COUNT] PROGMEM;
+
+inline const __FlashStringHelper* GetLabel(const Label label)
+{
+    return reinterpret_cast<const __FlashStringHelper*>(label_pool[label].s);
+}
+
+#endif
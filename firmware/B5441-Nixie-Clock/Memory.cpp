@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Memory.cpp
+ * @summary     SRAM usage monitor for ATmega328P
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#include "Memory.h"
+
+extern uint8_t _end;            // End of .bss and .noinit
+extern uint8_t __stack;         // Top of SRAM
+extern uint8_t __heap_start;    // Start of heap
+extern void* __brkval;          // Top of heap (0 if unused)
+
+void StackPaint(void) __attribute__((naked, used, section(".init3")));
+
+
+// Fill unused SRAM with canary before .data and .bss are initialized
+void StackPaint(void)
+{
+    // Stack is not yet in use - registers only
+    __asm__ __volatile__
+    (
+        "    ldi r30, lo8(_end)"    "\n\t"
+        "    ldi r31, hi8(_end)"    "\n\t"
+        "    ldi r24, %[canary]"    "\n\t"
+        "    ldi r25, hi8(__stack)" "\n\t"
+        "    rjmp 2f"               "\n\t"
+        "1:  st Z+, r24"            "\n\t"
+        "2:  cpi r30, lo8(__stack)" "\n\t"
+        "    cpc r31, r25"          "\n\t"
+        "    brlo 1b"               "\n\t"
+        "    breq 1b"               "\n\t"
+        :
+        : [canary] "M" (STACK_CANARY)
+    );
+}
+
+
+// Bytes between heap and stack at this moment
+uint16_t GetFreeMemory(void)
+{
+    uint8_t top;
+    uint8_t* heap = (__brkval == 0) ? &__heap_start : reinterpret_cast<uint8_t*>(__brkval);
+    return (&top - heap);
+}
+
+
+// Bytes never touched by the stack since boot (high-water mark)
+uint16_t GetStackUnused(void)
+{
+    const uint8_t* p = (__brkval == 0) ? &_end : reinterpret_cast<const uint8_t*>(__brkval);
+    uint16_t count = 0;
+
+    while ((p <= &__stack) && (*p == STACK_CANARY))
+    {
+        p++;
+        count++;
+    }
+
+    return count;
+}
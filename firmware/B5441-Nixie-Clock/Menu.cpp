@@ -26,6 +26,17 @@
  */
 
 #include "Menu.h"
+#include "Cathode.h"
+#include "Countdown.h"
+#include "Stopwatch.h"
+#include "Ticker.h"
+#include "History.h"
+#include "Temperature.h"
+#include "Timezone.h"
+#include "Memory.h"
+#include "Provision.h"
+#include "Solar.h"
+#include "Supervisor.h"
 
 extern StateStruct g_state;         // struct
 extern Config g_config;             // struct
@@ -37,10 +48,82 @@ extern bool IsInputIncrement(void); // Function
 extern bool IsInputSelect(void);    // Function
 extern bool IsInputUpdate(void);    // Function
 
-// Preferred character conversion
-// A B C D E F G H I J K L M N O P Q R S T U V W X Y Z
-// 4 8 6 2 3 4 6 8 1 3 8 1 0 0 0 9 2 2 5 7 0 0 3 8 9 2
-// _ _     _   _   _     _     _ _ _ _ _ _         _ _
+static const Label items_brightness[] PROGMEM = {LABEL_AUTO, LABEL_SET_1, LABEL_SET_2, LABEL_SET_3, LABEL_SET_4,
+                                                 LABEL_SET_5, LABEL_SET_6, LABEL_SET_7, LABEL_SET_8};
+static const Label items_time_format[] PROGMEM = {LABEL_H24, LABEL_H12};
+static const Label items_date_format[] PROGMEM = {LABEL_YYMMDD, LABEL_MMDDYY, LABEL_DDMMYY};
+static const Label items_temperature_unit[] PROGMEM = {LABEL_TEMP_C, LABEL_TEMP_F};
+static const Label items_state[] PROGMEM = {LABEL_DISABLE, LABEL_ENABLE};
+static const Label items_sync[] PROGMEM = {LABEL_DISABLE, LABEL_MASTER, LABEL_FOLLOWER};
+static const Label items_solar[] PROGMEM = {LABEL_DISABLE, LABEL_BRIGHT, LABEL_DISPLAY, LABEL_ENABLE};
+
+// Each setting is one row - rows chain through next while proceed matches
+static const MenuRowStruct menu_row[MENU_ROW_COUNT] PROGMEM =
+{
+    [MENU_ROW_BRIGHTNESS] =
+    {MenuKind::SELECT, LABEL_BRIGHT, offsetof(Config, brightness), 0, sizeof(items_brightness),
+     MENU_FLAG_PREVIEW, items_brightness, nullptr, MENU_ROW_GAIN, getValue(CDisplay::Brightness::AUTO)},
+    [MENU_ROW_GAIN] =
+    {MenuKind::VALUE, LABEL_GAIN, offsetof(Config, gain), 1, 50,
+     MENU_FLAG_NONE, nullptr, nullptr, MENU_ROW_OFFSET, MENU_ANY},
+    [MENU_ROW_OFFSET] =
+    {MenuKind::VALUE, LABEL_OFFSET, offsetof(Config, offset), 0, 20,
+     MENU_FLAG_NONE, nullptr, nullptr, MENU_ROW_END, MENU_ANY},
+    [MENU_ROW_TIME_FORMAT] =
+    {MenuKind::SELECT, LABEL_HOUR, offsetof(Config, time_format), 0, sizeof(items_time_format),
+     MENU_FLAG_NONE, items_time_format, nullptr, MENU_ROW_DATE_FORMAT, MENU_ANY},
+    [MENU_ROW_DATE_FORMAT] =
+    {MenuKind::SELECT, LABEL_DATE, offsetof(Config, date_format), 0, sizeof(items_date_format),
+     MENU_FLAG_NONE, items_date_format, nullptr, MENU_ROW_TEMPERATURE_UNIT, MENU_ANY},
+    [MENU_ROW_TEMPERATURE_UNIT] =
+    {MenuKind::SELECT, LABEL_TEMP, offsetof(Config, temperature_unit), 0, sizeof(items_temperature_unit),
+     MENU_FLAG_NONE, items_temperature_unit, nullptr, MENU_ROW_BLIP, MENU_ANY},
+    [MENU_ROW_BLIP] =
+    {MenuKind::SELECT, LABEL_BUZZER, offsetof(Config, noise), 0, sizeof(items_state),
+     MENU_FLAG_STATIC, items_state, nullptr, MENU_ROW_SYNC, MENU_ANY},
+    [MENU_ROW_SYNC] =
+    {MenuKind::SELECT, LABEL_SYNC, offsetof(Config, sync), 0, sizeof(items_sync),
+     MENU_FLAG_NONE, items_sync, nullptr, MENU_ROW_SOLAR, MENU_ANY},
+    [MENU_ROW_SOLAR] =
+    {MenuKind::SELECT, LABEL_SOLAR, offsetof(Config, solar), 0, sizeof(items_solar),
+     MENU_FLAG_NONE, items_solar, nullptr, MENU_ROW_LOCATION, MENU_ANY},
+    [MENU_ROW_LOCATION] =
+    {MenuKind::HANDLER, LABEL_LATITUDE, 0, 0, 0,
+     MENU_FLAG_NONE, nullptr, SetLocation, MENU_ROW_END, MENU_ANY},
+    [MENU_ROW_ALARM_STATE] =
+    {MenuKind::HANDLER, LABEL_ALARM, 0, 0, 0,
+     MENU_FLAG_NONE, nullptr, SetAlarmState, MENU_ROW_ALARM_TIME, MENU_ANY},
+    [MENU_ROW_ALARM_TIME] =
+    {MenuKind::HANDLER, LABEL_SET, 0, 0, 0,
+     MENU_FLAG_NONE, nullptr, SetAlarmTime, MENU_ROW_ALARM_DAYS, MENU_ANY},
+    [MENU_ROW_ALARM_DAYS] =
+    {MenuKind::HANDLER, LABEL_ALARM, 0, 0, 0,
+     MENU_FLAG_NONE, nullptr, SetAlarmDays, MENU_ROW_ALARM_MUSIC, MENU_ANY},
+    [MENU_ROW_ALARM_MUSIC] =
+    {MenuKind::HANDLER, LABEL_AUDIO, 0, 0, 0,
+     MENU_FLAG_NONE, nullptr, SetAlarmMusic, MENU_ROW_END, MENU_ANY},
+};
+
+// Select rows take item count from array size and MenuSelect() holds at most the limit
+static_assert(sizeof(Label) == 1, "Item count must equal array size");
+static_assert(sizeof(items_brightness) <= MENU_SELECT_LIMIT, "Brightness items exceed limit");
+static_assert(sizeof(items_time_format) <= MENU_SELECT_LIMIT, "Time format items exceed limit");
+static_assert(sizeof(items_date_format) <= MENU_SELECT_LIMIT, "Date format items exceed limit");
+static_assert(sizeof(items_temperature_unit) <= MENU_SELECT_LIMIT, "Temperature items exceed limit");
+static_assert(sizeof(items_state) <= MENU_SELECT_LIMIT, "State items exceed limit");
+static_assert(sizeof(items_sync) <= MENU_SELECT_LIMIT, "Sync items exceed limit");
+static_assert(sizeof(items_solar) <= MENU_SELECT_LIMIT, "Solar items exceed limit");
+
+// MenuRun() writes each field through uint8_t&
+static_assert(sizeof(Config::brightness) == 1, "Brightness field must be one byte");
+static_assert(sizeof(Config::gain) == 1, "Gain field must be one byte");
+static_assert(sizeof(Config::offset) == 1, "Offset field must be one byte");
+static_assert(sizeof(Config::time_format) == 1, "Time format field must be one byte");
+static_assert(sizeof(Config::date_format) == 1, "Date format field must be one byte");
+static_assert(sizeof(Config::temperature_unit) == 1, "Temperature field must be one byte");
+static_assert(sizeof(Config::noise) == 1, "Buzzer field must be one byte");
+static_assert(sizeof(Config::sync) == 1, "Sync field must be one byte");
+static_assert(sizeof(Config::solar) == 1, "Solar field must be one byte");
 
 void MenuInfo(void)
 {
@@ -62,34 +145,41 @@ void MenuInfo(void)
                 break;
             }
             
+            g_display.SetDisplayIndicator(false);
+            SupervisorCheckIn(TASK_LOOP); // Menu dispatch
+            
             switch (function)
             {
             case 0:
             {
-                float f_value;
-                int i_fraction;
-                int i_value;
-
-                f_value = g_rtc.GetTemperature(); // Get temperature in Celsius
-
-                if (g_config.temperature_unit == CRTC::Unit::F)
-                {
-                    f_value = g_rtc.ConvertTemperature(g_rtc.GetTemperature(), CRTC::Unit::C, CRTC::Unit::F);
-                }
-                
-                i_value = f_value;
-                i_fraction = ((f_value - i_value) * 100.0);
-
-                snprintf(s, DISPLAY_COUNT + 1, " %03u;%02u ", i_value, i_fraction);
+                int16_t value = GetTemperatureQuarter();
+                value = ConvertQuarterDegree(value, g_config.temperature_unit);
+                g_display.SetUnitIndicator(0, FormatTemperature(s, value)); // Sign
                 g_display.EffectScroll(s, CDisplay::Direction::LEFT, 80);
                 break;
             }
             case 1:
+                ViewHistory(HistoryWindow::DAY);
+                break;
+            case 2:
+                ViewHistory(HistoryWindow::WEEK);
+                break;
+            case 3:
                 snprintf(s, DISPLAY_COUNT+1, "  %04u  ", VERSION);
                 g_display.SetDisplayValue(s);
                 g_display.EffectSlotMachine(35);
                 break;
-            case 2:
+            case 4:
+                ViewCathode();
+                break;
+            case 5:
+                // Free SRAM now and never touched by stack since boot - up to 2048 each
+                snprintf_P(s, DISPLAY_COUNT + 1, PSTR("%04u%04u"), GetFreeMemory(), GetStackUnused());
+                g_display.SetDisplayValue(s);
+                g_display.SetUnitIndicator(3, true); // Separator
+                g_display.EffectSlotMachine(35);
+                break;
+            case 6:
                 RestoreOutOfBox();
                 break;
             }
@@ -103,7 +193,7 @@ void MenuInfo(void)
                 Detonate();
             }
         }
-        while ((function < 3) && timeout);
+        while ((function < 7) && timeout);
     }
     else
     {
@@ -124,11 +214,24 @@ void MenuSettings(void)
     prompt_select.display_mode = CDisplay::Mode::SCROLL;
     prompt_select.title = nullptr;
 
-    // Copy item table to local variable
-    char* array[sizeof(menu_item_array) / sizeof(char*)];
-    memcpy_P(array, menu_item_array, sizeof(array));
-    prompt_select.item_array = reinterpret_cast<type_const_char_ptr*>(array);
+    type_const_char_ptr item_array[] =
+    {
+        [MENU_ITEM_DIVERGENCE] = GetLabel(LABEL_DIVERGENCE),
+        [MENU_ITEM_TIMER] = GetLabel(LABEL_TIMER),
+        [MENU_ITEM_STOPWATCH] = GetLabel(LABEL_STOPWATCH),
+        [MENU_ITEM_TICKER] = GetLabel(LABEL_TICKER),
+        [MENU_ITEM_MUSIC] = GetLabel(LABEL_AUDIO),
+        [MENU_ITEM_BRIGHTNESS] = GetLabel(LABEL_BRIGHT),
+        [MENU_ITEM_BLANK] = GetLabel(LABEL_DISPLAY),
+        [MENU_ITEM_ALARM] = GetLabel(LABEL_ALARM),
+        [MENU_ITEM_CONFIG] = GetLabel(LABEL_SETTINGS),
+        [MENU_ITEM_TIME] = GetLabel(LABEL_TIME),
+        [MENU_ITEM_DATE] = GetLabel(LABEL_DATE),
+    };
+    
+    prompt_select.item_array = item_array;
     int8_t selection = g_display.PromptSelect(prompt_select, Timeout::MENU);
+    SupervisorCheckIn(TASK_LOOP); // Menu dispatch
     
     if (selection > -1)
     {
@@ -140,44 +243,15 @@ void MenuSettings(void)
             break;
         
         case MENU_ITEM_ALARM:
-        {
-            uint8_t alarm = 0; // Track selection
-            
-            if (SetAlarmState(alarm))
-            {
-                if (SetAlarmTime(alarm))
-                {
-                    if (SetAlarmDays(alarm))
-                    {
-                        SetMusic(g_config.alarm[alarm].music);
-                    }
-                }
-            }
-
+            MenuRun(MENU_ROW_ALARM_STATE);
             break;
-        }
             
         case MENU_ITEM_BRIGHTNESS:
-            if (SetBrightness() && (g_config.brightness == CDisplay::Brightness::AUTO))
-            {
-                if (SetGain())
-                {
-                    SetOffset();
-                }
-            }
+            MenuRun(MENU_ROW_BRIGHTNESS);
             break;
 
         case MENU_ITEM_CONFIG:
-            if (SetTimeFormat())
-            {
-                if (SetDateFormat())
-                {
-                    if (SetTemperatureUnit())
-                    {
-                        SetBlip();
-                    }
-                }
-            }
+            MenuRun(MENU_ROW_TIME_FORMAT);
             break;
 
         case MENU_ITEM_BLANK:
@@ -199,6 +273,14 @@ void MenuSettings(void)
         case MENU_ITEM_TIMER:
             SetTimer();
             break;
+
+        case MENU_ITEM_STOPWATCH:
+            Stopwatch();
+            break;
+
+        case MENU_ITEM_TICKER:
+            Ticker();
+            break;
         }
     }
 
@@ -206,13 +288,84 @@ void MenuSettings(void)
 }
 
 
+// Show minimum and maximum whole degrees logged within window
+void ViewHistory(const HistoryWindow window)
+{
+    char s[DISPLAY_COUNT + 1];
+    HistorySummary summary;
+    CRTC::RTC rtc;
+
+    g_rtc.GetRTC(rtc);
+
+    if (!GetHistorySummary(window, GetHourStamp(rtc), summary))
+    {
+        summary.minimum = 0;
+        summary.maximum = 0;
+    }
+
+    snprintf_P(s, DISPLAY_COUNT + 1, PSTR(" %03u;%03u"),
+               FormatQuarterDegree(summary.minimum),
+               FormatQuarterDegree(summary.maximum));
+    g_display.SetDisplayValue(s);
+    g_display.SetUnitIndicator(0, (window == HistoryWindow::WEEK));
+    g_display.EffectSlotMachine(35);
+}
+
+
+// Round quarter degrees Celsius to whole degrees of configured unit
+uint16_t FormatQuarterDegree(const int16_t value)
+{
+    int16_t degree;
+
+    if (g_config.temperature_unit == CRTC::Unit::F)
+    {
+        degree = ((value * 9) + (32 * 20) + 10) / 20; // F = C * 9 / 5 + 32
+    }
+    else
+    {
+        degree = (value + 2) / 4;
+    }
+
+    return max(degree, 0); // Tubes cannot show sign
+}
+
+
+// Browse lit hours of each tube and digit
+void ViewCathode(void)
+{
+    char s[DISPLAY_COUNT + 1];
+    uint8_t index = 0;
+    uint32_t timeout;
+
+    IsInputUpdate(); // Clear any update
+
+    do
+    {
+        uint8_t tube = index / CATHODE_COUNT;
+        uint8_t digit = index % CATHODE_COUNT;
+        uint32_t hours = GetCathodeUnits(tube, digit) / CATHODE_UNITS_PER_HOUR;
+        snprintf_P(s, DISPLAY_COUNT + 1, PSTR("%u%u;%05lu"), tube, digit, hours);
+        g_display.SetDisplayValue(s);
+
+        if (++index >= (DISPLAY_COUNT * CATHODE_COUNT))
+        {
+            index = 0;
+        }
+
+        timeout = Timeout::INFO;
+        while (!IsInputUpdate() && !IsInputSelect() && --timeout);
+    }
+    while (timeout && !IsInputSelect());
+}
+
+
 int8_t SelectCycle(const Cycle init_value)
 {
     CDisplay::PromptSelectStruct prompt_select;
     prompt_select.item_count = 2;
     prompt_select.initial_selection = getValue(init_value);
-    prompt_select.title = F(" 932102 "); // PERIOD
-    type_const_char_ptr item_array[] = {F("   40   "), F("   90   ")}; // AM PM
+    prompt_select.title = GetLabel(LABEL_PERIOD);
+    type_const_char_ptr item_array[] = {GetLabel(LABEL_AM), GetLabel(LABEL_PM)};
     prompt_select.item_array = item_array;
     return g_display.PromptSelect(prompt_select, Timeout::SELECT);
 }
@@ -222,7 +375,7 @@ int8_t SelectState(CDisplay::PromptSelectStruct& prompt_select)
 {
     prompt_select.item_count = 2;
     prompt_select.display_mode = CDisplay::Mode::STATIC;
-    type_const_char_ptr item_array[] = {F("2154813 "), F(" 304813 ")}; // ENABLE DISABLE
+    type_const_char_ptr item_array[] = {GetLabel(LABEL_DISABLE), GetLabel(LABEL_ENABLE)};
     prompt_select.item_array = item_array;
     return g_display.PromptSelect(prompt_select, Timeout::SELECT);
 }
@@ -270,16 +423,16 @@ bool RestoreOutOfBox(void)
 {
     CDisplay::PromptSelectStruct prompt_select;
     prompt_select.item_count = 2;
-    prompt_select.title = F(" 23537  "); // RESET
-    type_const_char_ptr item_array[] = {F(" 640631 "), F(" 23527  ")}; // CANCEL RESET
+    prompt_select.title = GetLabel(LABEL_RESET);
+    type_const_char_ptr item_array[] = {GetLabel(LABEL_CANCEL), GetLabel(LABEL_RESET)};
     prompt_select.item_array = item_array;
     int8_t selection = g_display.PromptSelect(prompt_select, Timeout::SELECT);
 
     if (selection > 0)
     {
         Config new_config; // Use default constructor values
-        SetConfig(new_config); // Write to EEPROM
-        GetConfig(g_config); // Read from EEPROM
+        GetProfile(new_config); // Site profile when provisioned
+        ApplyConfig(new_config);
         return true;
     }
 
@@ -290,24 +443,34 @@ bool RestoreOutOfBox(void)
 bool SetBlank(void)
 {
     char s[DISPLAY_COUNT + 1];
-    uint8_t hour, minute;
-    CDisplay::PromptValueStruct prompt_value;
+    CDisplay::PromptSelectStruct prompt_select;
+    prompt_select.item_count = BLANK_WINDOW_COUNT;
+    prompt_select.title = GetLabel(LABEL_DISPLAY);
+    type_const_char_ptr item_array[BLANK_WINDOW_COUNT];
 
-    for (uint8_t index = 0; index < 2; index++)
+    for (uint8_t index = 0; index < BLANK_WINDOW_COUNT; index++)
     {
-        if (index)
-        {
-            prompt_value.title = F("9032 00 "); // POWR ON
-            hour = g_config.blank_end / 3600;
-            minute = (g_config.blank_end / 60) % 60;
-        }
-        else
-        {
-            prompt_value.title = F("9032 044"); // POWR OFF
-            hour = g_config.blank_begin / 3600;
-            minute = (g_config.blank_begin / 60) % 60;
-        }
+        item_array[index] = GetLabel(static_cast<Label>(LABEL_SET_1 + index));
+    }
+
+    prompt_select.item_array = item_array;
+    int8_t selection = g_display.PromptSelect(prompt_select, Timeout::SELECT);
+
+    if (selection < 0)
+    {
+        return false;
+    }
+
+    BlankWindowStruct& window = g_config.blank[selection];
+    CDisplay::PromptValueStruct prompt_value;
+    bool result = true;
 
+    for (uint8_t index = 0; result && (index < 2); index++)
+    {
+        uint16_t& minutes = (index ? window.end : window.begin);
+        uint8_t hour = minutes / 60;
+        uint8_t minute = minutes % 60;
+        prompt_value.title = GetLabel(index ? LABEL_POWER_ON : LABEL_POWER_OFF);
         snprintf_P(s, DISPLAY_COUNT + 1, PSTR(" %02u;%02u %01u"), FormatHour(hour), minute, index);
         type_const_uint8 item_value[] = {hour, minute};
         prompt_value.item_count = 2;
@@ -316,196 +479,181 @@ bool SetBlank(void)
         prompt_value.item_value = item_value;
         prompt_value.initial_display = s;
 
-        if (SelectRTCValue(prompt_value))
-        {
-            uint32_t value = GetSeconds(prompt_value.item_value[0], prompt_value.item_value[1], 0);
-            
-            if (index)
-            {
-                g_config.blank_end = value;
-            }
-            else
-            {
-                g_config.blank_begin = value;
-            }
+        result = SelectRTCValue(prompt_value);
 
-            SetConfig(g_config);
-        }
-        else
+        if (result)
         {
-            return false;
+            minutes = (prompt_value.item_value[0] * 60) + prompt_value.item_value[1];
+            SetConfig(g_config);
         }
     }
 
-    return true;
+    result = result && SelectDays(window.days);
+    UpdateBlankSchedule(); // Stored fields apply even when a prompt timed out
+    return result;
 }
 
 
-bool SetBrightness(void)
+// Latitude then longitude - first digit 1 selects south or west
+bool SetLocation(uint8_t& context)
 {
-    CDisplay::PromptSelectStruct prompt_select;
-    prompt_select.item_count = 9;
-    prompt_select.initial_selection = getValue(g_config.brightness);
-    prompt_select.title = F(" 821687 "); // BRIGHT
-    type_const_char_ptr item_array[] = {F("  4070  "), F("  537 1 "), F("  537 2 "), // AUTO SET x
-                                        F("  537 3 "), F("  537 4 "), F("  537 5 "),
-                                        F("  537 6 "), F("  537 7 "), F("  537 8 ")};
-    prompt_select.item_array = item_array;
-    g_display.SetDisplayBrightness(g_config.brightness); // Set initial brightness
-    
-    int8_t selection = g_display.PromptSelect(prompt_select, Timeout::SELECT,
-    [](CDisplay::Event event, uint8_t selection) -> bool
+    char s[DISPLAY_COUNT + 1];
+    CDisplay::PromptValueStruct prompt_value;
+
+    if (g_config.solar == SolarMode::DISABLE)
     {
-        switch (event)
+        return true; // Location unused
+    }
+
+    for (uint8_t index = 0; index < 2; index++)
+    {
+        int16_t& value = (index ? g_config.longitude : g_config.latitude);
+        uint16_t limit = (index ? SOLAR_LONGITUDE_LIMIT : SOLAR_LATITUDE_LIMIT);
+        uint16_t magnitude = abs(value);
+        uint8_t sign = (value < 0);
+        snprintf_P(s, DISPLAY_COUNT + 1, PSTR(" %01u %03u %01u"), sign, magnitude / 10, magnitude % 10);
+        type_const_uint8 item_value[] = {sign, static_cast<uint8_t>(magnitude / 10), static_cast<uint8_t>(magnitude % 10)};
+        type_const_uint8 item_upper_limit[] = {1, static_cast<uint8_t>(limit / 10), 9};
+        prompt_value.title = GetLabel(index ? LABEL_LONGITUDE : LABEL_LATITUDE);
+        prompt_value.item_count = 3;
+        prompt_value.item_position = (const uint8_t []){1, 3, 7};
+        prompt_value.item_digit_count = (const uint8_t []){1, 3, 1};
+        prompt_value.item_value = item_value;
+        prompt_value.item_lower_limit = (const type_const_uint8 []){0, 0, 0};
+        prompt_value.item_upper_limit = item_upper_limit;
+        prompt_value.initial_display = s;
+
+        if (g_display.PromptValue(prompt_value, Timeout::VALUE) < 0)
         {
-        case CDisplay::Event::DECREMENT:
-        case CDisplay::Event::INCREMENT:
-            if (static_cast<CDisplay::Brightness>(selection) == CDisplay::Brightness::AUTO)
-            {
-                CDisplay::Brightness brightness;
-                brightness = ReadLightIntensity();
-                
-                if (brightness == CDisplay::Brightness::MIN)
-                {
-                    brightness = CDisplay::Brightness::L1;
-                }
-                
-                g_display.SetDisplayBrightness(brightness);
-            }
-            else
-            {
-                g_display.SetDisplayBrightness(static_cast<CDisplay::Brightness>(selection));
-            }
-            break;
-        
-        case CDisplay::Event::SELECTION:
-            break;
-        case CDisplay::Event::TIMEOUT:
-            g_display.SetDisplayBrightness(g_config.brightness); // Restore brightness
-            break;
-        
-        default:
-            break;
+            return false;
         }
-        
-        return false;
-    });
 
-    if (selection > -1)
-    {
-        g_config.brightness = static_cast<decltype(g_config.brightness)>(selection);
+        magnitude = min((item_value[1] * 10) + item_value[2], limit);
+        value = (item_value[0] ? -magnitude : magnitude);
         SetConfig(g_config);
-        return true;
     }
 
-    return false;
+    return true;
 }
 
 
-bool SetGain(void)
+// Run chain of menu rows starting at index
+bool MenuRun(MenuRow index)
 {
-    char s[DISPLAY_COUNT + 1];
-    CDisplay::PromptValueStruct prompt_value;
-    snprintf_P(s, DISPLAY_COUNT + 1, PSTR("   %02u   "), g_config.gain);
-    type_const_uint8 item_value[] = {g_config.gain};
-    prompt_value.item_count = 1;
-    prompt_value.item_position = (const uint8_t []){3};
-    prompt_value.item_digit_count = (const uint8_t []){2};
-    prompt_value.item_value = item_value;
-    prompt_value.item_lower_limit = (const type_const_uint8 []){1};
-    prompt_value.item_upper_limit = (const type_const_uint8 []){50};
-    prompt_value.initial_display = s;
-    prompt_value.title = F("  6410  "); // GAIN
+    uint8_t context = 0; // Carried along chain - alarm number
 
-    if (g_display.PromptValue(prompt_value, Timeout::VALUE) > -1)
+    while (index != MENU_ROW_END)
     {
-        g_config.gain = prompt_value.item_value[0];
-        SetConfig(g_config);
-        return true;
-    }
+        MenuRowStruct row;
+        memcpy_P(&row, &menu_row[index], sizeof(row));
+        uint8_t& value = reinterpret_cast<uint8_t*>(&g_config)[row.field];
+        bool result;
+        SupervisorCheckIn(TASK_LOOP); // Menu dispatch
 
-    return false;
-}
+        switch (row.kind)
+        {
+        default:
+        case MenuKind::SELECT:
+            result = MenuSelect(row, value);
+            break;
 
+        case MenuKind::VALUE:
+            result = MenuValue(row, value);
+            break;
 
-bool SetOffset(void)
-{
-    char s[DISPLAY_COUNT + 1];
-    CDisplay::PromptValueStruct prompt_value;
-    snprintf_P(s, DISPLAY_COUNT + 1, PSTR("   %02u   "), g_config.offset);
-    type_const_uint8 item_value[] = {g_config.offset};
-    prompt_value.item_count = 1;
-    prompt_value.item_position = (const uint8_t []){3};
-    prompt_value.item_digit_count = (const uint8_t []){2};
-    prompt_value.item_value = item_value;
-    prompt_value.item_lower_limit = (const type_const_uint8 []){0};
-    prompt_value.item_upper_limit = (const type_const_uint8 []){20};
-    prompt_value.initial_display = s;
-    prompt_value.title = F(" 044537 "); // OFFSET
+        case MenuKind::HANDLER:
+            result = row.handler(context);
+            break;
+        }
 
-    if (g_display.PromptValue(prompt_value, Timeout::VALUE) > -1)
-    {
-        g_config.offset = prompt_value.item_value[0];
-        SetConfig(g_config);
-        return true;
+        if (!result)
+        {
+            return false;
+        }
+
+        if ((row.proceed != MENU_ANY) && (value != row.proceed))
+        {
+            break; // Remaining rows do not apply
+        }
+
+        index = row.next;
     }
 
-    return false;
+    return true;
 }
 
 
-bool SetBlip(void)
+bool MenuSelect(const MenuRowStruct& row, uint8_t& value)
 {
-    CDisplay::PromptSelectStruct prompt_select;
-    prompt_select.initial_selection = getValue(g_config.noise);
-    prompt_select.title = F(" 802232 "); // BUZZER
-    int8_t selection = SelectState(prompt_select);
+    type_const_char_ptr item_array[MENU_SELECT_LIMIT];
 
-    if (selection > -1)
+    for (uint8_t index = 0; index < row.upper; index++)
     {
-        g_config.noise = static_cast<decltype(g_config.noise)>(selection);
-        SetConfig(g_config);
-        return true;
+        item_array[index] = GetLabel(static_cast<Label>(pgm_read_byte(&row.items[index])));
     }
 
-    return false;
-}
-
-
-bool SetTimeFormat(void)
-{
     CDisplay::PromptSelectStruct prompt_select;
-    prompt_select.item_count = 2;
-    prompt_select.initial_selection = getValue(g_config.time_format);
-    prompt_select.title = F("  8002  "); // HOUR
-    type_const_char_ptr item_array[] = {F("  ;24:  "), F("  ;12:  ")};
+    prompt_select.item_count = row.upper;
+    prompt_select.initial_selection = value;
+    prompt_select.title = GetLabel(row.title);
     prompt_select.item_array = item_array;
-    int8_t selection = g_display.PromptSelect(prompt_select, Timeout::SELECT);
+    int8_t selection;
 
-    if (selection > -1)
+    if (row.flags & MENU_FLAG_STATIC)
     {
-        g_config.time_format = static_cast<decltype(g_config.time_format)>(selection);
-        SetConfig(g_config);
-        return true;
+        prompt_select.display_mode = CDisplay::Mode::STATIC;
     }
 
-    return false;
-}
-
+    if (row.flags & MENU_FLAG_PREVIEW)
+    {
+        g_display.SetDisplayBrightness(g_config.brightness); // Set initial brightness
 
-bool SetDateFormat(void)
-{
-    CDisplay::PromptSelectStruct prompt_select;
-    prompt_select.item_count = 3;
-    prompt_select.initial_selection = getValue(g_config.date_format);
-    prompt_select.title = F("  2473  "); // DATE
-    type_const_char_ptr item_array[] = {F("99:12:31"), F("12:31:99"), F("31:12:99")};
-    prompt_select.item_array = item_array;
-    int8_t selection = g_display.PromptSelect(prompt_select, Timeout::SELECT);
+        selection = g_display.PromptSelect(prompt_select, Timeout::SELECT,
+        [](CDisplay::Event event, uint8_t selection) -> bool
+        {
+            switch (event)
+            {
+            case CDisplay::Event::DECREMENT:
+            case CDisplay::Event::INCREMENT:
+                if (static_cast<CDisplay::Brightness>(selection) == CDisplay::Brightness::AUTO)
+                {
+                    CDisplay::Brightness brightness;
+                    brightness = ReadLightIntensity();
+                    
+                    if (brightness == CDisplay::Brightness::MIN)
+                    {
+                        brightness = CDisplay::Brightness::L1;
+                    }
+                    
+                    g_display.SetDisplayBrightness(brightness);
+                }
+                else
+                {
+                    g_display.SetDisplayBrightness(static_cast<CDisplay::Brightness>(selection));
+                }
+                break;
+            
+            case CDisplay::Event::SELECTION:
+                break;
+            case CDisplay::Event::TIMEOUT:
+                g_display.SetDisplayBrightness(g_config.brightness); // Restore brightness
+                break;
+            
+            default:
+                break;
+            }
+            
+            return false;
+        });
+    }
+    else
+    {
+        selection = g_display.PromptSelect(prompt_select, Timeout::SELECT);
+    }
 
     if (selection > -1)
     {
-        g_config.date_format = static_cast<decltype(g_config.date_format)>(selection);
+        value = selection;
         SetConfig(g_config);
         return true;
     }
@@ -514,19 +662,26 @@ bool SetDateFormat(void)
 }
 
 
-bool SetTemperatureUnit(void)
+bool MenuValue(const MenuRowStruct& row, uint8_t& value)
 {
-    CDisplay::PromptSelectStruct prompt_select;
-    prompt_select.item_count = 2;
-    prompt_select.initial_selection = getValue(g_config.temperature_unit);
-    prompt_select.title = F("  7309  "); // TEMP
-    type_const_char_ptr item_array[] = {F(" 7309 6 "), F(" 7309 4 ")}; // TEMP C TEMP F
-    prompt_select.item_array = item_array;
-    int8_t selection = g_display.PromptSelect(prompt_select, Timeout::SELECT);
+    char s[DISPLAY_COUNT + 1];
+    CDisplay::PromptValueStruct prompt_value;
+    snprintf_P(s, DISPLAY_COUNT + 1, PSTR("   %02u   "), value);
+    type_const_uint8 item_value[] = {value};
+    type_const_uint8 item_lower_limit[] = {row.lower};
+    type_const_uint8 item_upper_limit[] = {row.upper};
+    prompt_value.item_count = 1;
+    prompt_value.item_position = (const uint8_t []){3};
+    prompt_value.item_digit_count = (const uint8_t []){2};
+    prompt_value.item_value = item_value;
+    prompt_value.item_lower_limit = item_lower_limit;
+    prompt_value.item_upper_limit = item_upper_limit;
+    prompt_value.initial_display = s;
+    prompt_value.title = GetLabel(row.title);
 
-    if (selection > -1)
+    if (g_display.PromptValue(prompt_value, Timeout::VALUE) > -1)
     {
-        g_config.temperature_unit = static_cast<decltype(g_config.temperature_unit)>(selection);
+        value = prompt_value.item_value[0];
         SetConfig(g_config);
         return true;
     }
@@ -548,13 +703,14 @@ bool SetTime(void)
     prompt_value.item_digit_count = (const uint8_t []){2, 2, 2};
     prompt_value.item_value = item_value;
     prompt_value.initial_display = s;
-    prompt_value.title = F("  7103  "); // TIME
+    prompt_value.title = GetLabel(LABEL_TIME);
 
     if (SelectRTCValue(prompt_value))
     {
         g_rtc.SetTime(prompt_value.item_value[0],
                       prompt_value.item_value[1],
                       prompt_value.item_value[2]);
+        TimezoneSeek(); // Entered time is already local
         return true;
     }
 
@@ -605,14 +761,14 @@ bool SetDate(void)
     }
 
     prompt_value.initial_display = s;
-    prompt_value.title = F("  2473  "); // DATE
+    prompt_value.title = GetLabel(LABEL_DATE);
 
     if (g_display.PromptValue(prompt_value, Timeout::VALUE) > -1)
     {
         g_rtc.SetDate(prompt_value.item_value[item_value_index[0]],
                       prompt_value.item_value[item_value_index[1]],
                       prompt_value.item_value[item_value_index[2]]);
-
+        TimezoneSeek(); // Entered date is already local
         return true;
     }
 
@@ -622,25 +778,17 @@ bool SetDate(void)
 
 bool SetAlarmState(uint8_t& alarm)
 {
-    type_const_char_ptr alarm_str[] = {F(" 4;1  0 "), F(" 4;1  1 "),    // A1 OFF, A1 ON
-                                       F(" 4;2  0 "), F(" 4;2  1 "),    // A2 OFF, A2 ON
-                                       F(" 4;3  0 "), F(" 4;3  1 ")};   // A3 OFF, A3 ON
-    uint8_t alarm_index[ALARM_COUNT];
+    type_const_char_ptr item_array[ALARM_COUNT];
     
     for (uint8_t index = 0; index < ALARM_COUNT; index++)
     {
         bool state = (g_config.alarm[index].state == State::ENABLE);
-        alarm_index[index] = (index * 2) + state;
+        item_array[index] = GetLabel(static_cast<Label>(LABEL_A1_OFF + (index * 2) + state));
     }
     
     CDisplay::PromptSelectStruct prompt_select;
     prompt_select.item_count = ALARM_COUNT;
     prompt_select.display_mode = CDisplay::Mode::SCROLL;
-    
-    type_const_char_ptr item_array[ALARM_COUNT] = {alarm_str[alarm_index[0]],
-                                                   alarm_str[alarm_index[1]],
-                                                   alarm_str[alarm_index[2]]};
-    
     prompt_select.item_array = item_array;
     int8_t selection_alarm = g_display.PromptSelect(prompt_select, Timeout::SELECT);
 
@@ -677,7 +825,7 @@ bool SetAlarmState(uint8_t& alarm)
 }
 
 
-bool SetAlarmTime(const uint8_t alarm)
+bool SetAlarmTime(uint8_t& alarm)
 {
     char s[DISPLAY_COUNT + 1];
     CDisplay::PromptValueStruct prompt_value;
@@ -692,7 +840,7 @@ bool SetAlarmTime(const uint8_t alarm)
     prompt_value.item_digit_count = (const uint8_t []){2, 2};
     prompt_value.item_value = item_value;
     prompt_value.initial_display = s;
-    prompt_value.title = F("  537   "); // SET
+    prompt_value.title = GetLabel(LABEL_SET);
 
     if (SelectRTCValue(prompt_value))
     {
@@ -706,7 +854,17 @@ bool SetAlarmTime(const uint8_t alarm)
 }
 
 
-bool SetAlarmDays(const uint8_t alarm)
+bool SetAlarmDays(uint8_t& alarm)
+{
+    bool result = SelectDays(g_config.alarm[alarm].days);
+    g_config.alarm[alarm].state = (g_config.alarm[alarm].days == 0) ? State::DISABLE : State::ENABLE;
+    SetConfig(g_config);
+    return result;
+}
+
+
+// Toggle each RTC week day bit of days until DONE
+bool SelectDays(uint8_t& days)
 {
     int8_t selection = -1;
 
@@ -717,22 +875,22 @@ bool SetAlarmDays(const uint8_t alarm)
         prompt_select.item_count = 8;
         prompt_select.initial_selection = selection;
         prompt_select.display_mode = CDisplay::Mode::SCROLL;
-        type_const_char_ptr item_array[] = {F("500249 1"), F("000249 2"), F("703579 3"), // SUNDAY MONDAY TUESDAY
-                                            F("320529 4"), F("782529 5"), F("421249 6"), // WDNSDY THRSDY FRIDAY
-                                            F("547429 7"), F("  2003  ")};               // SATRDY DONE
+        type_const_char_ptr item_array[] = {GetLabel(LABEL_SUNDAY), GetLabel(LABEL_MONDAY),
+                                            GetLabel(LABEL_TUESDAY), GetLabel(LABEL_WEDNESDAY),
+                                            GetLabel(LABEL_THURSDAY), GetLabel(LABEL_FRIDAY),
+                                            GetLabel(LABEL_SATURDAY), GetLabel(LABEL_DONE)};
         prompt_select.item_array = item_array;
         selection = g_display.PromptSelect(prompt_select, Timeout::SELECT);
 
         if ((selection < 7) && (selection > -1))
         {
             CDisplay::PromptSelectStruct prompt_select_e;
-            prompt_select_e.initial_selection = ((g_config.alarm_state >> (selection + 1)) & 0x1);
+            prompt_select_e.initial_selection = ((days >> (selection + 1)) & 0x1);
             int8_t state = SelectState(prompt_select_e);
 
             if (state > -1)
             {
-                g_config.alarm[alarm].days ^= (-state ^ g_config.alarm[alarm].days) & (0x1 << (selection + 1));
-                g_config.alarm[alarm].state = (g_config.alarm[alarm].days == 0) ? State::DISABLE : State::ENABLE;
+                days ^= (-state ^ days) & (0x1 << (selection + 1));
                 SetConfig(g_config);
             }
             else
@@ -750,6 +908,12 @@ bool SetAlarmDays(const uint8_t alarm)
     return false;
 }
 
+
+bool SetAlarmMusic(uint8_t& alarm)
+{
+    return SetMusic(g_config.alarm[alarm].music);
+}
+
     
 bool SetMusic(uint8_t& music)
 {
@@ -767,7 +931,7 @@ bool SetMusic(uint8_t& music)
     prompt_value.item_lower_limit = (const type_const_uint8 []){0};
     prompt_value.item_upper_limit = item_upper_limit;
     prompt_value.initial_display = s;
-    prompt_value.title = F(" 40210  "); // AUDIO
+    prompt_value.title = GetLabel(LABEL_AUDIO);
 
     InterruptSpeed(INTERRUPT_SLOW);
     
@@ -792,6 +956,7 @@ bool SetMusic(uint8_t& music)
             //Don't time out during playback
             if (g_audio.IsActive())
             {
+                SupervisorCheckIn(TASK_LOOP); // Song may outlast deadline
                 return true;
             }
 
@@ -811,8 +976,94 @@ bool SetMusic(uint8_t& music)
 }
 
 
+// Show remaining time of active timers and return the one selected
+int8_t ViewCountdown(void)
+{
+    const uint8_t REFRESH = 50; // Milliseconds per refresh
+    const uint8_t IDLE_LIMIT = (Timeout::VALUE / REFRESH);
+    char s[DISPLAY_COUNT + 1];
+    uint8_t index = COUNTDOWN_COUNT - 1;
+    uint8_t idle = IDLE_LIMIT;
+
+    IsInputUpdate(); // Clear any update
+    while (IsInputSelect()); // Wait until release
+
+    do
+    {
+        if (idle == IDLE_LIMIT)
+        {
+            uint8_t count = COUNTDOWN_COUNT;
+
+            // Advance to next active timer
+            do
+            {
+                index = ((index + 1) % COUNTDOWN_COUNT);
+            } while (!IsCountdownActive(index) && --count);
+
+            if (!count)
+            {
+                return -1; // All timers expired while viewing
+            }
+
+            g_display.SetDisplayIndicator(false);
+            g_display.SetUnitIndicator(index, true); // Timer number
+        }
+
+        uint32_t remaining = GetCountdownRemaining(index);
+        uint8_t hour = remaining / 3600;
+        uint8_t minute = (remaining / 60) % 60;
+        uint8_t second = remaining % 60;
+        snprintf_P(s, DISPLAY_COUNT + 1, PSTR("%02u:%02u:%02u"), hour, minute, second);
+        g_display.SetDisplayValue(s);
+
+        delay(REFRESH);
+
+        if (IsInputSelect())
+        {
+            g_display.SetDisplayIndicator(false);
+            return index;
+        }
+
+        idle = (IsInputUpdate() ? IDLE_LIMIT : idle - 1);
+    }
+    while (idle);
+
+    g_display.SetDisplayIndicator(false);
+    return -1;
+}
+
+
 void SetTimer(void)
 {
+    if (IsCountdownActive())
+    {
+        int8_t index = ViewCountdown();
+
+        if (index < 0)
+        {
+            return;
+        }
+
+        CDisplay::PromptSelectStruct prompt_select;
+        prompt_select.item_count = 2;
+        prompt_select.title = GetLabel(LABEL_TIMER);
+        type_const_char_ptr item_array[] = {GetLabel(LABEL_SET), GetLabel(LABEL_CANCEL)};
+        prompt_select.item_array = item_array;
+
+        switch (g_display.PromptSelect(prompt_select, Timeout::SELECT))
+        {
+        case 0:
+            break; // Set another timer
+
+        case 1:
+            CountdownCancel(index);
+            return;
+
+        default:
+            return;
+        }
+    }
+
     uint32_t timer = 500;
     char s[DISPLAY_COUNT + 1];
     CDisplay::PromptValueStruct prompt_value;
@@ -828,13 +1079,20 @@ void SetTimer(void)
     prompt_value.item_upper_limit = (const type_const_uint8 []){23, 59, 59};
     prompt_value.item_value = item_value;
     prompt_value.initial_display = s;
-    prompt_value.title = F("  537   "); // SET
+    prompt_value.title = GetLabel(LABEL_SET);
 
     if (g_display.PromptValue(prompt_value, Timeout::VALUE) > -1)
     {
-        Timer(prompt_value.item_value[0],
-              prompt_value.item_value[1],
-              prompt_value.item_value[2]);
+        uint32_t seconds = GetSeconds(prompt_value.item_value[0],
+                                      prompt_value.item_value[1],
+                                      prompt_value.item_value[2]);
+
+        // Timer runs in background while clock face is shown
+        if (seconds && (CountdownStart(seconds) < 0))
+        {
+            g_display.SetDisplayValue(GetLabel(LABEL_CANCEL)); // No free timer
+            delay(1000);
+        }
     }
 }
 
@@ -851,7 +1109,7 @@ long SetWorldLine(void)
     prompt_value.item_upper_limit = (type_item *)(const type_item []){10, 9, 9, 9, 9, 9, 9};
     prompt_value.item_value = item_value;
     prompt_value.initial_display = "0:000000";
-    prompt_value.title = F("  537   ");
+    prompt_value.title = GetLabel(LABEL_SET);
 
     int8_t result = g_display.PromptValue(prompt_value, Timeout::VALUE,
     [&prompt_value](CDisplay::Event event, uint8_t selection) -> bool
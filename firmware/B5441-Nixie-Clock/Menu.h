@@ -29,6 +29,8 @@
 #define _MENU_H
  
 #include "B5441-Nixie-Clock.h"
+#include "Label.h"
+#include "History.h"
 
 typedef type_array type_const_char_ptr;
 typedef type_item type_const_uint8;
@@ -45,6 +47,8 @@ enum MENU_ITEM : uint8_t
 {
     MENU_ITEM_DIVERGENCE,
     MENU_ITEM_TIMER,
+    MENU_ITEM_STOPWATCH,
+    MENU_ITEM_TICKER,
     MENU_ITEM_MUSIC,
     MENU_ITEM_BRIGHTNESS,
     MENU_ITEM_BLANK,
@@ -55,54 +59,82 @@ enum MENU_ITEM : uint8_t
     MENU_ITEM_COUNT, // Number of menu items
 };
 
-// Preferred character conversion
-// A B C D E F G H I J K L M N O P Q R S T U V W X Y Z
-// 4 8 6 2 3 4 6 8 1 3 8 1 0 0 0 9 2 2 5 7 0 0 3 8 9 2
-// _ _     _   _   _     _     _ _ _ _ _ _         _ _
+enum class MenuKind : uint8_t
+{
+    SELECT,  // Choose one label for a Config field
+    VALUE,   // Enter a two digit Config field
+    HANDLER, // Call function with chain context
+};
+
+enum MenuRow : uint8_t
+{
+    MENU_ROW_BRIGHTNESS,
+    MENU_ROW_GAIN,
+    MENU_ROW_OFFSET,
+    MENU_ROW_TIME_FORMAT,
+    MENU_ROW_DATE_FORMAT,
+    MENU_ROW_TEMPERATURE_UNIT,
+    MENU_ROW_BLIP,
+    MENU_ROW_SYNC,
+    MENU_ROW_SOLAR,
+    MENU_ROW_LOCATION,
+    MENU_ROW_ALARM_STATE,
+    MENU_ROW_ALARM_TIME,
+    MENU_ROW_ALARM_DAYS,
+    MENU_ROW_ALARM_MUSIC,
+    MENU_ROW_COUNT, // Number of menu rows
+    MENU_ROW_END = MENU_ROW_COUNT,
+};
+
+enum MenuFlag : uint8_t
+{
+    MENU_FLAG_NONE    = 0x00,
+    MENU_FLAG_STATIC  = 0x01, // Select without scrolling
+    MENU_FLAG_PREVIEW = 0x02, // Apply brightness while browsing
+};
+
+const uint8_t MENU_ANY = 0xFF; // Chain regardless of stored value
+const uint8_t MENU_SELECT_LIMIT = 9; // Most items of any select row
 
-static const char menu_item_DIVERGENCE[] PROGMEM    = "21046063";
-static const char menu_item_TIMER[] PROGMEM         = " 71037  ";
-static const char menu_item_MUSIC[] PROGMEM         = " 40210  ";
-static const char menu_item_BRIGHTNESS[] PROGMEM    = " 821687 ";
-static const char menu_item_BLANK[] PROGMEM         = "2159149 ";
-static const char menu_item_ALARM[] PROGMEM         = " 41423  ";
-static const char menu_item_CONFIG[] PROGMEM        = "53771065";
-static const char menu_item_TIME[] PROGMEM          = "  7103  ";
-static const char menu_item_DATE[] PROGMEM          = "  2473  ";
+typedef bool (*MenuHandler)(uint8_t& context);
 
-static PGM_P const menu_item_array[] PROGMEM =
+struct MenuRowStruct
 {
-    [MENU_ITEM_DIVERGENCE] = menu_item_DIVERGENCE,
-    [MENU_ITEM_TIMER] = menu_item_TIMER,
-    [MENU_ITEM_MUSIC] = menu_item_MUSIC,
-    [MENU_ITEM_BRIGHTNESS] = menu_item_BRIGHTNESS,
-    [MENU_ITEM_BLANK] = menu_item_BLANK,
-    [MENU_ITEM_ALARM] = menu_item_ALARM,
-    [MENU_ITEM_CONFIG] = menu_item_CONFIG,
-    [MENU_ITEM_TIME] = menu_item_TIME,
-    [MENU_ITEM_DATE] = menu_item_DATE,
+    MenuKind        kind;
+    Label           title;
+    uint8_t         field;      // Offset within Config
+    uint8_t         lower;      // Lower limit of value
+    uint8_t         upper;      // Upper limit of value or item count
+    uint8_t         flags;
+    const Label*    items;      // Item labels in flash
+    MenuHandler     handler;
+    MenuRow         next;
+    uint8_t         proceed;    // Stored value required to chain
 };
 
 void MenuInfo(void);
 void MenuSettings(void);
+void ViewHistory(const HistoryWindow window);
+uint16_t FormatQuarterDegree(const int16_t value);
+void ViewCathode(void);
 int8_t SelectCycle(const Cycle init_value);
 int8_t SelectState(CDisplay::PromptSelectStruct& prompt_select);
 bool SelectRTCValue(CDisplay::PromptValueStruct& prompt_value);
 bool RestoreOutOfBox(void);
 bool SetBlank(void);
-bool SetBrightness(void);
-bool SetGain(void);
-bool SetOffset(void);
-bool SetTimeFormat(void);
-bool SetDateFormat(void);
-bool SetTemperatureUnit(void);
-bool SetBlip(void);
+bool SetLocation(uint8_t& context);
+bool MenuRun(MenuRow index);
+bool MenuSelect(const MenuRowStruct& row, uint8_t& value);
+bool MenuValue(const MenuRowStruct& row, uint8_t& value);
 bool SetTime(void);
 bool SetDate(void);
 bool SetAlarmState(uint8_t& alarm);
-bool SetAlarmTime(const uint8_t alarm);
-bool SetAlarmDays(const uint8_t alarm);
+bool SetAlarmTime(uint8_t& alarm);
+bool SetAlarmDays(uint8_t& alarm);
+bool SetAlarmMusic(uint8_t& alarm);
+bool SelectDays(uint8_t& days);
 bool SetMusic(uint8_t& music);
+int8_t ViewCountdown(void);
 void SetTimer(void);
 long SetWorldLine(void);
 
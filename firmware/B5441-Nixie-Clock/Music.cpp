@@ -26,6 +26,7 @@
  */
 
 #include "Music.h"
+#include "Trace.h"
 
 extern CAudio g_audio;
 
@@ -41,6 +42,7 @@ void PlayMusic(const uint8_t index)
     // Entries < INBUILT_SONG_COUNT are stored in DATA
     if (index < INBUILT_SONG_COUNT)
     {
+        TRACE_MARK(TRACE_AUDIO, index);
         g_audio.Play(CAudio::Functions::PGMStream, GetMusicDATA(index, 0), GetMusicDATA(index, 1));
     }
 }
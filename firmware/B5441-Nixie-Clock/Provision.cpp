@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Provision.cpp
+ * @summary     Config import, export and site profile for B5441 Nixie clock
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#include <util/crc16.h>
+#include "Provision.h"
+#include "Solar.h"
+#include "Supervisor.h"
+#include "Telemetry.h"
+#include "Trace.h"
+
+extern Config g_config;             // struct
+extern CDisplay g_display;          // class
+extern uint8_t g_song_entries;      // integral
+
+static_assert((sizeof(Config) + sizeof(uint16_t)) <= 130, "Config exceeds site profile slot");
+static_assert(offsetof(Config, validate) == 0, "Key must precede fields written before it");
+
+static const uint8_t NIBBLE_END = 0xFE; // Line terminated
+static const uint8_t NIBBLE_ERROR = 0xFF;
+
+static uint8_t GetStateByte(const State& state);
+static void DiscardLine(void);
+static int16_t ReadHexByte(void);
+static uint8_t ReadHexNibble(void);
+
+
+// CRC of frame header and body as sent over UART
+uint16_t GetConfigCRC(const Config& config)
+{
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(&config);
+    uint16_t crc = 0;
+
+    crc = _crc_xmodem_update(crc, CONFIG_KEY);
+    crc = _crc_xmodem_update(crc, sizeof(Config));
+
+    for (uint8_t index = 0; index < sizeof(Config); index++)
+    {
+        crc = _crc_xmodem_update(crc, data[index]);
+    }
+
+    return crc;
+}
+
+
+// Limits of the menus - CRC proves transport only
+bool IsConfigValid(const Config& config)
+{
+    bool valid = (GetStateByte(config.noise) <= 1) &&
+                 (getValue(config.brightness) <= getValue(CDisplay::Brightness::MAX)) &&
+                 (config.gain >= 1) && (config.gain <= 50) &&
+                 (config.offset <= 20) &&
+                 (getValue(config.date_format) <= getValue(FormatDate::DDMMYY)) &&
+                 (getValue(config.time_format) <= getValue(FormatTime::H12)) &&
+                 (getValue(config.temperature_unit) <= getValue(CRTC::Unit::F)) &&
+                 (config.music_timer < g_song_entries) &&
+                 (getValue(config.solar) <= getValue(SolarMode::ALL)) &&
+                 (abs(config.latitude) <= static_cast<int16_t>(SOLAR_LATITUDE_LIMIT)) &&
+                 (abs(config.longitude) <= static_cast<int16_t>(SOLAR_LONGITUDE_LIMIT)) &&
+                 (getValue(config.sync) <= getValue(SyncMode::FOLLOWER));
+
+    for (uint8_t index = 0; valid && (index < ALARM_COUNT); index++)
+    {
+        const AlarmStruct& alarm = config.alarm[index];
+        valid = (GetStateByte(alarm.state) <= 1) && (alarm.music < g_song_entries) &&
+                (alarm.time < 86400);
+    }
+
+    for (uint8_t index = 0; valid && (index < BLANK_WINDOW_COUNT); index++)
+    {
+        const BlankWindowStruct& window = config.blank[index];
+        valid = (window.begin < 1440) && (window.end < 1440);
+    }
+
+    return valid;
+}
+
+
+// Site profile replaces config only when intact and of current layout
+bool GetProfile(Config& config)
+{
+    Config profile;
+    uint16_t crc;
+
+    while (!eeprom_is_ready());
+    eeprom_read_block(&profile, reinterpret_cast<const void*>(EEPROM_PROFILE), sizeof(Config));
+    crc = eeprom_read_word(reinterpret_cast<const uint16_t*>(EEPROM_PROFILE + sizeof(Config)));
+
+    if ((profile.validate != CONFIG_KEY) || (crc != GetConfigCRC(profile)) || !IsConfigValid(profile))
+    {
+        return false;
+    }
+
+    config = profile;
+    return true;
+}
+
+
+// Key is cleared first and written last so an interrupted write reverts
+// to defaults at boot instead of loading a partial config
+void ApplyConfig(const Config& config)
+{
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(&config);
+    uint8_t* key = reinterpret_cast<uint8_t*>(EEPROM_CONFIG + offsetof(Config, validate));
+
+    TRACE_BEGIN(TRACE_CONFIG, 1);
+    while (!eeprom_is_ready());
+    cli();
+    eeprom_update_byte(key, 0);
+    eeprom_update_block(data + 1, reinterpret_cast<void*>(EEPROM_CONFIG + 1), sizeof(Config) - 1);
+    eeprom_update_byte(key, CONFIG_KEY);
+    sei();
+    TRACE_END(TRACE_CONFIG, 1);
+
+    GetConfig(g_config);
+    g_display.SetDisplayBrightness(g_config.brightness);
+    UpdateAlarmIndicator();
+    UpdateBlankSchedule();
+}
+
+
+void ProvisionExport(void)
+{
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(&g_config);
+    uint16_t crc = GetConfigCRC(g_config);
+
+    TelemetryPrint(PSTR("C%02X%02X"), CONFIG_KEY, sizeof(Config));
+
+    for (uint8_t index = 0; index < sizeof(Config); index++)
+    {
+        TelemetryPrint(PSTR("%02X"), data[index]);
+    }
+
+    TelemetryPrint(PSTR("%02X%02X\r\n"), crc & 0xFF, crc >> 8);
+}
+
+
+// Whole frame is validated before EEPROM is touched. Sender waits for the
+// ready line so the frame streams while this loop drains the ring.
+ProvisionResult ProvisionImport(const bool profile)
+{
+    Config config;
+    uint8_t* data = reinterpret_cast<uint8_t*>(&config);
+    TelemetryPrint(PSTR("%c ready\r\n"), profile ? COMMAND_PROFILE : COMMAND_PUSH);
+    int16_t key = ReadHexByte();
+    int16_t size = ReadHexByte();
+    ProvisionResult result = ProvisionResult::OK;
+
+    if ((key < 0) || (size < 0))
+    {
+        result = ProvisionResult::FORMAT;
+    }
+    else if ((key != CONFIG_KEY) || (size != sizeof(Config)))
+    {
+        result = ProvisionResult::VERSION;
+    }
+    else
+    {
+        for (uint8_t index = 0; (index < sizeof(Config)) && (result == ProvisionResult::OK); index++)
+        {
+            int16_t value = ReadHexByte();
+            data[index] = value;
+            result = (value < 0) ? ProvisionResult::FORMAT : result;
+        }
+
+        int16_t crc_low = ReadHexByte();
+        int16_t crc_high = ReadHexByte();
+
+        if ((result != ProvisionResult::OK) || (crc_low < 0) || (crc_high < 0))
+        {
+            result = ProvisionResult::FORMAT;
+        }
+        else if (((crc_high << 8) | crc_low) != GetConfigCRC(config))
+        {
+            result = ProvisionResult::CRC;
+        }
+        else if (config.validate != CONFIG_KEY)
+        {
+            result = ProvisionResult::VERSION;
+        }
+        else if (ReadHexNibble() != NIBBLE_END)
+        {
+            result = ProvisionResult::FORMAT;
+        }
+        else if (!IsConfigValid(config))
+        {
+            result = ProvisionResult::RANGE;
+        }
+    }
+
+    if ((result != ProvisionResult::OK) && (result != ProvisionResult::RANGE))
+    {
+        DiscardLine(); // Rest of a rejected frame is not commands
+    }
+
+    if (result == ProvisionResult::OK)
+    {
+        if (profile)
+        {
+            uint16_t crc = GetConfigCRC(config);
+            while (!eeprom_is_ready());
+            cli();
+            eeprom_update_block(&config, reinterpret_cast<void*>(EEPROM_PROFILE), sizeof(Config));
+            eeprom_update_block(&crc, reinterpret_cast<void*>(EEPROM_PROFILE + sizeof(Config)), sizeof(crc));
+            sei();
+        }
+        else
+        {
+            ApplyConfig(config);
+        }
+    }
+
+    TelemetryPrint(PSTR("%c result=%u\r\n"), profile ? COMMAND_PROFILE : COMMAND_PUSH, getValue(result));
+    return result;
+}
+
+
+// Stored byte of a bool enum - any other value is corrupt
+static uint8_t GetStateByte(const State& state)
+{
+    return *reinterpret_cast<const uint8_t*>(&state);
+}
+
+
+// Read until line end or until sender pauses
+static void DiscardLine(void)
+{
+    uint32_t start = millis();
+
+    while ((millis() - start) < PROVISION_TIMEOUT)
+    {
+        if (TelemetryAvailable())
+        {
+            uint8_t c = TelemetryRead();
+            start = millis();
+
+            if ((c == '\r') || (c == '\n'))
+            {
+                return;
+            }
+        }
+    }
+}
+
+
+// Return value of two hex characters or -1
+static int16_t ReadHexByte(void)
+{
+    uint8_t high = ReadHexNibble();
+    uint8_t low = ReadHexNibble();
+
+    if ((high > 0x0F) || (low > 0x0F))
+    {
+        return -1;
+    }
+
+    return (high << 4) | low;
+}
+
+
+// Return nibble value, line end or error on timeout and bad character
+static uint8_t ReadHexNibble(void)
+{
+    uint32_t start = millis();
+
+    while (!TelemetryAvailable())
+    {
+        if ((millis() - start) >= PROVISION_TIMEOUT)
+        {
+            return NIBBLE_ERROR;
+        }
+    }
+
+    uint8_t c = TelemetryRead();
+    SupervisorCheckIn(TASK_LOOP); // Frame advanced
+
+    if ((c >= '0') && (c <= '9'))
+    {
+        return c - '0';
+    }
+    else if ((c >= 'A') && (c <= 'F'))
+    {
+        return c - 'A' + 10;
+    }
+    else if ((c >= 'a') && (c <= 'f'))
+    {
+        return c - 'a' + 10;
+    }
+    else if ((c == '\r') || (c == '\n'))
+    {
+        return NIBBLE_END;
+    }
+
+    return NIBBLE_ERROR;
+}
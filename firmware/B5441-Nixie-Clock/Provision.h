@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Provision.h
+ * @summary     Config import, export and site profile for B5441 Nixie clock
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#ifndef _PROVISION_H
+#define _PROVISION_H
+
+#include "B5441-Nixie-Clock.h"
+
+const uint16_t PROVISION_TIMEOUT = 250; // Milliseconds per byte of frame
+
+// Frame is hex of key, size, Config bytes and CRC-16/XMODEM of all before
+enum class ProvisionResult : uint8_t
+{
+    OK,
+    FORMAT,     // Incomplete, not hex or not terminated
+    VERSION,    // Config layout differs
+    CRC,        // Frame corrupted
+    RANGE,      // Field outside what the menus allow
+};
+
+uint16_t GetConfigCRC(const Config& config);
+bool IsConfigValid(const Config& config);
+bool GetProfile(Config& config);
+void ApplyConfig(const Config& config);
+void ProvisionExport(void);
+ProvisionResult ProvisionImport(const bool profile);
+
+#endif
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Schedule.cpp
+ * @summary     Time-driven alarm and blanking decisions for B5441 Nixie clock
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#include "Schedule.h"
+
+
+// RTC week days run 1 to 7
+uint8_t GetNextWeekDay(const uint8_t week_day)
+{
+    return (week_day > 6) ? 1 : (week_day + 1);
+}
+
+
+// Minutes since start of RTC week day 1
+uint16_t GetWeekMinute(const uint8_t week_day, const uint8_t hour, const uint8_t minute)
+{
+    return ((week_day - 1) * 1440) + (hour * 60) + minute;
+}
+
+
+// Return index of first alarm due at minute time or -1 if none
+int8_t GetAlarmDue(const Config& config, const uint8_t week_day, const uint32_t time)
+{
+    for (uint8_t index = 0; index < ALARM_COUNT; index++)
+    {
+        const AlarmStruct& alarm = config.alarm[index];
+
+        // Check if alarm is enabled
+        if (alarm.state == State::ENABLE)
+        {
+            // Check if alarm day matches current day
+            if ((alarm.days >> week_day) & 0x1)
+            {
+                // Check if alarm time matches current time
+                if (alarm.time == time)
+                {
+                    return index;
+                }
+            }
+        }
+    }
+
+    return -1;
+}
+
+
+// Indicate when any alarm will sound within the next occurrence of its time
+State GetAlarmIndicator(const Config& config, const uint8_t week_day, const uint32_t time)
+{
+    for (uint8_t index = 0; index < ALARM_COUNT; index++)
+    {
+        const AlarmStruct& alarm = config.alarm[index];
+
+        // Check if alarm is enabled
+        if (alarm.state == State::ENABLE)
+        {
+            // Determine which day to check
+            uint8_t day = ((alarm.time > time) ? week_day : GetNextWeekDay(week_day));
+
+            // Check if alarm is active for selected day
+            if ((alarm.days >> day) & 0x1)
+            {
+                return State::ENABLE;
+            }
+        }
+    }
+
+    return State::DISABLE;
+}
+
+
+// Merge every window into one sorted list of state changes
+void BlankCompile(const Config& config, BlankScheduleStruct& schedule)
+{
+    uint16_t edge[BLANK_TRANSITION_LIMIT]; // Minute with begin flag
+    uint8_t edge_count = 0;
+    uint8_t depth = 0; // Windows covering current minute
+
+    for (uint8_t index = 0; index < BLANK_WINDOW_COUNT; index++)
+    {
+        const BlankWindowStruct& window = config.blank[index];
+        uint16_t length = (window.end + 1440 - window.begin) % 1440;
+        length = length ? length : 1440;
+
+        for (uint8_t week_day = 1; week_day <= 7; week_day++)
+        {
+            if ((window.days >> week_day) & 0x1)
+            {
+                uint16_t begin = GetWeekMinute(week_day, 0, 0) + window.begin;
+                uint16_t end = (begin + length) % WEEK_MINUTES;
+                depth += (end <= begin); // Covers start of week
+                edge[edge_count++] = begin | BLANK_TRANSITION_STATE;
+                edge[edge_count++] = end;
+            }
+        }
+    }
+
+    // Insertion sort by minute - few entries
+    for (uint8_t index = 1; index < edge_count; index++)
+    {
+        uint16_t value = edge[index];
+        uint8_t position = index;
+
+        while (position && ((edge[position - 1] & ~BLANK_TRANSITION_STATE) > (value & ~BLANK_TRANSITION_STATE)))
+        {
+            edge[position] = edge[position - 1];
+            position--;
+        }
+
+        edge[position] = value;
+    }
+
+    bool state = depth; // Blanked at start of week
+    schedule.count = 0;
+
+    for (uint8_t index = 0; index < edge_count; index++)
+    {
+        uint16_t minute = edge[index] & ~BLANK_TRANSITION_STATE;
+        depth = (edge[index] & BLANK_TRANSITION_STATE) ? depth + 1 : depth - 1;
+
+        // Record once all edges sharing a minute are applied
+        if (((index + 1) == edge_count) || ((edge[index + 1] & ~BLANK_TRANSITION_STATE) != minute))
+        {
+            if (state != (depth > 0))
+            {
+                state = (depth > 0);
+                schedule.transition[schedule.count++] = minute | (state ? BLANK_TRANSITION_STATE : 0);
+            }
+        }
+    }
+
+    schedule.blanked = state; // Holds all week when no transitions
+    schedule.next = BLANK_SEEK;
+}
+
+
+// Return event for transitions crossed since last call - last one wins,
+// and schedule.blanked holds the resulting state
+BlankEvent GetBlankEvent(BlankScheduleStruct& schedule, const uint16_t minute)
+{
+    uint16_t elapsed = (minute + WEEK_MINUTES - schedule.minute) % WEEK_MINUTES;
+    uint16_t previous = schedule.minute;
+    BlankEvent event = BlankEvent::NONE;
+
+    schedule.minute = minute;
+
+    if (!schedule.count)
+    {
+        // Always or never blanked - adopt once after compile
+        if (schedule.next == BLANK_SEEK)
+        {
+            schedule.next = 0;
+            return (schedule.blanked ? BlankEvent::BLANK : BlankEvent::WAKE);
+        }
+
+        return BlankEvent::NONE;
+    }
+
+    if ((schedule.next == BLANK_SEEK) || (elapsed > BLANK_STALL_LIMIT))
+    {
+        // Adopt state of most recent transition
+        schedule.next = 0;
+
+        while ((schedule.next < schedule.count) &&
+               ((schedule.transition[schedule.next] & ~BLANK_TRANSITION_STATE) <= minute))
+        {
+            schedule.next++;
+        }
+
+        uint8_t last = (schedule.next ? schedule.next : schedule.count) - 1;
+        schedule.next %= schedule.count;
+        schedule.blanked = (schedule.transition[last] & BLANK_TRANSITION_STATE);
+        return (schedule.blanked ? BlankEvent::BLANK : BlankEvent::WAKE);
+    }
+
+    // Catch up on every transition passed while stalled
+    for (uint8_t count = schedule.count; count; count--)
+    {
+        uint16_t transition = schedule.transition[schedule.next];
+        uint16_t distance = ((transition & ~BLANK_TRANSITION_STATE) + WEEK_MINUTES - previous) % WEEK_MINUTES;
+
+        if (!distance || (distance > elapsed))
+        {
+            break;
+        }
+
+        schedule.blanked = (transition & BLANK_TRANSITION_STATE);
+        event = (schedule.blanked ? BlankEvent::BLANK : BlankEvent::WAKE);
+        schedule.next = (schedule.next + 1) % schedule.count;
+    }
+
+    return event;
+}
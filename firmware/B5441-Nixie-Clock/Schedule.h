@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Schedule.h
+ * @summary     Time-driven alarm and blanking decisions for B5441 Nixie clock
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#ifndef _SCHEDULE_H
+#define _SCHEDULE_H
+
+#include "B5441-Nixie-Clock.h"
+
+// Decisions take time as arguments and touch no hardware so that any
+// clock source, real or simulated, can drive them
+
+enum class BlankEvent : uint8_t
+{
+    NONE,
+    WAKE,   // Display enabled
+    BLANK,  // Display disabled
+};
+
+const uint16_t WEEK_MINUTES = 7 * 1440;
+const uint8_t BLANK_TRANSITION_LIMIT = BLANK_WINDOW_COUNT * 7 * 2;
+const uint16_t BLANK_TRANSITION_STATE = 0x8000; // Display blanked from minute
+const uint8_t BLANK_SEEK = 0xFF; // Next transition unknown
+const uint16_t BLANK_STALL_LIMIT = 1440; // Minutes - larger gap means clock set
+
+// Transitions of all windows merged and sorted by minute of week
+struct BlankScheduleStruct
+{
+    uint16_t    transition[BLANK_TRANSITION_LIMIT]; // Minute with state flag
+    uint8_t     count;
+    uint8_t     next;   // Index of next transition
+    uint16_t    minute; // Minute of week last evaluated
+    bool        blanked; // Schedule state at minute - constant when count is 0
+};
+
+uint8_t GetNextWeekDay(const uint8_t week_day);
+uint16_t GetWeekMinute(const uint8_t week_day, const uint8_t hour, const uint8_t minute);
+int8_t GetAlarmDue(const Config& config, const uint8_t week_day, const uint32_t time);
+State GetAlarmIndicator(const Config& config, const uint8_t week_day, const uint32_t time);
+void BlankCompile(const Config& config, BlankScheduleStruct& schedule);
+BlankEvent GetBlankEvent(BlankScheduleStruct& schedule, const uint16_t minute);
+
+#endif
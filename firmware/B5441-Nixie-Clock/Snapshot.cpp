@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Snapshot.cpp
+ * @summary     Asynchronous DS3232 register snapshot for B5441 Nixie clock
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#include "Snapshot.h"
+#include "Trace.h"
+
+extern CI2C::Handle g_rtc_device;  // struct
+
+static uint8_t g_buffer[SNAPSHOT_SIZE];
+static volatile SnapshotState g_state_snapshot = SnapshotState::IDLE;
+static volatile uint8_t g_status;
+static int16_t g_temperature = 0; // Quarter degrees Celsius
+
+
+static uint8_t FromBCD(const uint8_t value)
+{
+    return ((value >> 4) * 10) + (value & 0x0F);
+}
+
+
+// Called from I2C interrupt on completion
+static void SnapshotComplete(const uint8_t status)
+{
+    g_status = status;
+    g_state_snapshot = SnapshotState::COMPLETE;
+    TRACE_END(TRACE_I2C, status);
+}
+
+
+// Queue burst read of register window unless one is outstanding
+void SnapshotRequest(void)
+{
+    if (g_state_snapshot == SnapshotState::IDLE)
+    {
+        g_state_snapshot = SnapshotState::PENDING;
+        TRACE_BEGIN(TRACE_I2C, 0);
+        nI2C->Read(g_rtc_device, DS3232_REGISTER_TIME, g_buffer, SNAPSHOT_SIZE, SnapshotComplete);
+    }
+}
+
+
+// Decode completed snapshot into rtc and queue the next - never waits on bus
+bool SnapshotPoll(CRTC::RTC& rtc)
+{
+    bool updated = false;
+
+    if (g_state_snapshot == SnapshotState::COMPLETE)
+    {
+        if (g_status == 0)
+        {
+            uint8_t hour = g_buffer[2];
+
+            if (hour & 0x40)
+            {
+                // 12 hour mode with PM flag in bit 5
+                hour = (FromBCD(hour & 0x1F) % 12) + ((hour & 0x20) ? 12 : 0);
+            }
+            else
+            {
+                hour = FromBCD(hour & 0x3F);
+            }
+
+            rtc.second = FromBCD(g_buffer[0] & 0x7F);
+            rtc.minute = FromBCD(g_buffer[1] & 0x7F);
+            rtc.hour = hour;
+            rtc.am = (hour < 12);
+            rtc.week_day = (g_buffer[3] & 0x07);
+            rtc.day = FromBCD(g_buffer[4] & 0x3F);
+            rtc.month = FromBCD(g_buffer[5] & 0x1F);
+            rtc.year = FromBCD(g_buffer[6]);
+
+            uint8_t msb = g_buffer[DS3232_REGISTER_TEMPERATURE - DS3232_REGISTER_TIME];
+            uint8_t lsb = g_buffer[DS3232_REGISTER_TEMPERATURE - DS3232_REGISTER_TIME + 1];
+            g_temperature = (static_cast<int8_t>(msb) * 4) + (lsb >> 6);
+            updated = true;
+        }
+
+        g_state_snapshot = SnapshotState::IDLE; // Failed reads are retried
+    }
+
+    SnapshotRequest();
+    return updated;
+}
+
+
+// Wait out any transfer in flight and drop its result
+void SnapshotDiscard(void)
+{
+    while (g_state_snapshot == SnapshotState::PENDING);
+    g_state_snapshot = SnapshotState::IDLE;
+}
+
+
+// Temperature from most recent snapshot - DS3232 converts every 64 seconds
+int16_t GetSnapshotTemperature(void)
+{
+    return g_temperature;
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Snapshot.h
+ * @summary     Asynchronous DS3232 register snapshot for B5441 Nixie clock
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#ifndef _SNAPSHOT_H
+#define _SNAPSHOT_H
+
+#include "B5441-Nixie-Clock.h"
+
+// Time, date, alarms, control and temperature in one contiguous window
+const uint8_t SNAPSHOT_SIZE = (DS3232_REGISTER_TEMPERATURE + 2) - DS3232_REGISTER_TIME;
+
+enum class SnapshotState : uint8_t
+{
+    IDLE,       // No transfer outstanding
+    PENDING,    // Burst read queued on bus
+    COMPLETE,   // Buffer filled by callback
+};
+
+void SnapshotRequest(void);
+bool SnapshotPoll(CRTC::RTC& rtc);
+void SnapshotDiscard(void);
+int16_t GetSnapshotTemperature(void);
+
+#endif
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Solar.cpp
+ * @summary     Sun elevation from fixed-point tables for B5441 Nixie clock
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#include "Solar.h"
+#include "SolarTable.h"
+
+static const uint16_t month_start[] PROGMEM = {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
+
+
+// Days since 1 January, 0 to 365
+uint16_t GetYearDay(const uint8_t year, const uint8_t month, const uint8_t day)
+{
+    uint16_t result = pgm_read_word(&month_start[month - 1]) + day - 1;
+    return result + ((month > 2) && !(year % 4));
+}
+
+
+// Quarter wave lookup with linear interpolation - Q14
+int16_t GetSine(const uint16_t angle)
+{
+    uint16_t phase = angle & 0x3FFF;
+
+    if (angle & 0x4000)
+    {
+        phase = 0x4000 - phase; // Falling quarter mirrors rising
+    }
+
+    uint8_t index = phase >> 8;
+    uint16_t value = pgm_read_word(&sine_table[index]);
+
+    if (phase & 0xFF)
+    {
+        uint16_t next = pgm_read_word(&sine_table[index + 1]);
+        value += (static_cast<uint32_t>(next - value) * (phase & 0xFF)) >> 8;
+    }
+
+    return ((angle & 0x8000) ? -value : value);
+}
+
+
+// Sine of sun elevation - offset is local time ahead of UTC in minutes
+int16_t GetSolarElevation(const Config& config, const CRTC::RTC& rtc, const int16_t offset)
+{
+    uint16_t day = GetYearDay(rtc.year, rtc.month, rtc.day);
+    uint8_t index = day / SOLAR_STEP_DAYS;
+    uint8_t fraction = day % SOLAR_STEP_DAYS;
+    SolarEntry entry[2];
+    memcpy_P(entry, &solar_table[index], sizeof(entry));
+
+    int16_t declination = entry[0].declination +
+                          ((entry[1].declination - entry[0].declination) * fraction) / SOLAR_STEP_DAYS;
+    int16_t equation = entry[0].equation +
+                       ((entry[1].equation - entry[0].equation) * fraction) / SOLAR_STEP_DAYS;
+
+    // 1440 minutes and 3600 tenths of degree are each one turn
+    int16_t minute = (rtc.hour * 60) + rtc.minute - offset + 1440; // UTC, kept positive
+    uint16_t time = (static_cast<uint32_t>(minute) * 2048) / 45;
+    uint16_t latitude = (static_cast<int32_t>(config.latitude) * 4096) / 225;
+    uint16_t longitude = (static_cast<int32_t>(config.longitude) * 4096) / 225;
+    uint16_t hour = time + longitude + equation + 0x8000; // Zero at solar noon
+
+    // sin(elevation) = sin(lat) sin(dec) + cos(lat) cos(dec) cos(hour)
+    int32_t cosine = (static_cast<int32_t>(GetSine(latitude + 0x4000)) *
+                      GetSine(declination + 0x4000)) >> 14;
+    int32_t sine = static_cast<int32_t>(GetSine(latitude)) * GetSine(declination);
+    sine += cosine * GetSine(hour + 0x4000);
+    return (sine >> 14);
+}
+
+
+// Weight from 0 at end of civil twilight to maximum once sun is as high again
+uint8_t GetDaylight(const int16_t elevation)
+{
+    if (elevation <= -SOLAR_TWILIGHT)
+    {
+        return 0;
+    }
+
+    if (elevation >= SOLAR_TWILIGHT)
+    {
+        return SOLAR_DAYLIGHT_MAX;
+    }
+
+    return (static_cast<int32_t>(elevation + SOLAR_TWILIGHT) * SOLAR_DAYLIGHT_MAX) / (2 * SOLAR_TWILIGHT);
+}
+
+
+// Hold photodiode level within a band that follows the sun
+uint8_t GetSolarBrightness(const uint8_t value, const int16_t elevation)
+{
+    const uint8_t max = getValue(CDisplay::Brightness::MAX);
+    uint8_t daylight = GetDaylight(elevation);
+    uint8_t lower = 1 + (((SOLAR_DAY_FLOOR - 1) * daylight) / SOLAR_DAYLIGHT_MAX);
+    uint8_t upper = SOLAR_NIGHT_CEILING + (((max - SOLAR_NIGHT_CEILING) * daylight) / SOLAR_DAYLIGHT_MAX);
+
+    if (value < lower)
+    {
+        return lower;
+    }
+
+    return ((value > upper) ? upper : value);
+}
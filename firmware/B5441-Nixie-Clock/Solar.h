@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Solar.h
+ * @summary     Sun elevation from fixed-point tables for B5441 Nixie clock
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#ifndef _SOLAR_H
+#define _SOLAR_H
+
+#include "B5441-Nixie-Clock.h"
+
+// Angles are 1/65536 turn so that wrapping is free, sines are Q14. Like
+// Schedule, decisions take time as arguments and touch no hardware.
+
+const int16_t SOLAR_ONE = 16384; // Sine of quarter turn
+const uint8_t SOLAR_STEP_DAYS = 5; // Days between table entries
+const int16_t SOLAR_HORIZON = -238; // Sine of -0.83 degrees - sunrise and sunset
+const int16_t SOLAR_TWILIGHT = 1713; // Sine of 6 degrees - civil twilight either side
+const uint8_t SOLAR_DAYLIGHT_MAX = 16; // Daylight weight in full sun
+const uint8_t SOLAR_NIGHT_CEILING = 3; // Brightest level with sun down
+const uint8_t SOLAR_DAY_FLOOR = 4; // Dimmest level with sun up
+const uint16_t SOLAR_LATITUDE_LIMIT = 900; // Tenths of degree
+const uint16_t SOLAR_LONGITUDE_LIMIT = 1800; // Tenths of degree
+
+struct SolarEntry
+{
+    int16_t     declination;    // Angle of sun from equator
+    int16_t     equation;       // Angle of solar noon before mean noon
+};
+
+uint16_t GetYearDay(const uint8_t year, const uint8_t month, const uint8_t day);
+int16_t GetSine(const uint16_t angle);
+int16_t GetSolarElevation(const Config& config, const CRTC::RTC& rtc, const int16_t offset);
+uint8_t GetDaylight(const int16_t elevation);
+uint8_t GetSolarBrightness(const uint8_t value, const int16_t elevation);
+
+inline bool IsSolarMode(const SolarMode mode, const SolarMode flag)
+{
+    return (getValue(mode) & getValue(flag));
+}
+
+#endif
@@ -0,0 +1,100 @@
+// Generated by tools/solarcompile.py - do not edit
+
+#ifndef _SOLAR_TABLE_H
+#define _SOLAR_TABLE_H
+
+// Quarter wave, one entry per 256 angle units
+const uint16_t sine_table[65] PROGMEM =
+{
+        0,   402,   804,  1205,  1606,  2006,  2404,  2801,
+     3196,  3590,  3981,  4370,  4756,  5139,  5520,  5897,
+     6270,  6639,  7005,  7366,  7723,  8076,  8423,  8765,
+     9102,  9434,  9760, 10080, 10394, 10702, 11003, 11297,
+    11585, 11866, 12140, 12406, 12665, 12916, 13160, 13395,
+    13623, 13842, 14053, 14256, 14449, 14635, 14811, 14978,
+    15137, 15286, 15426, 15557, 15679, 15791, 15893, 15986,
+    16069, 16143, 16207, 16261, 16305, 16340, 16364, 16379,
+    16384,
+};
+
+// Every 5 days from 1 January - angles in 1/65536 turn
+const SolarEntry solar_table[75] PROGMEM =
+{
+    { -4191,  -142}, // Day   0 -23.02 deg  -3.13 min
+    { -4101,  -241}, // Day   5 -22.53 deg  -5.30 min
+    { -3978,  -333}, // Day  10 -21.85 deg  -7.33 min
+    { -3823,  -417}, // Day  15 -21.00 deg  -9.15 min
+    { -3637,  -489}, // Day  20 -19.98 deg -10.74 min
+    { -3422,  -549}, // Day  25 -18.80 deg -12.06 min
+    { -3181,  -595}, // Day  30 -17.48 deg -13.08 min
+    { -2917,  -628}, // Day  35 -16.02 deg -13.79 min
+    { -2631,  -645}, // Day  40 -14.45 deg -14.18 min
+    { -2327,  -648}, // Day  45 -12.78 deg -14.24 min
+    { -2007,  -637}, // Day  50 -11.02 deg -13.99 min
+    { -1674,  -612}, // Day  55  -9.19 deg -13.45 min
+    { -1330,  -575}, // Day  60  -7.31 deg -12.63 min
+    {  -979,  -527}, // Day  65  -5.38 deg -11.58 min
+    {  -623,  -470}, // Day  70  -3.42 deg -10.32 min
+    {  -264,  -406}, // Day  75  -1.45 deg  -8.91 min
+    {    96,  -336}, // Day  80  +0.53 deg  -7.39 min
+    {   454,  -265}, // Day  85  +2.49 deg  -5.81 min
+    {   807,  -192}, // Day  90  +4.44 deg  -4.22 min
+    {  1155,  -121}, // Day  95  +6.34 deg  -2.67 min
+    {  1494,   -54}, // Day 100  +8.21 deg  -1.20 min
+    {  1823,     7}, // Day 105 +10.02 deg  +0.15 min
+    {  2140,    60}, // Day 110 +11.75 deg  +1.33 min
+    {  2442,   105}, // Day 115 +13.41 deg  +2.31 min
+    {  2727,   140}, // Day 120 +14.98 deg  +3.07 min
+    {  2994,   164}, // Day 125 +16.45 deg  +3.60 min
+    {  3240,   177}, // Day 130 +17.80 deg  +3.88 min
+    {  3464,   178}, // Day 135 +19.03 deg  +3.91 min
+    {  3663,   169}, // Day 140 +20.12 deg  +3.70 min
+    {  3837,   149}, // Day 145 +21.08 deg  +3.27 min
+    {  3983,   120}, // Day 150 +21.88 deg  +2.64 min
+    {  4100,    84}, // Day 155 +22.52 deg  +1.84 min
+    {  4187,    41}, // Day 160 +23.00 deg  +0.90 min
+    {  4243,    -6}, // Day 165 +23.31 deg  -0.13 min
+    {  4269,   -55}, // Day 170 +23.45 deg  -1.22 min
+    {  4262,  -105}, // Day 175 +23.41 deg  -2.31 min
+    {  4225,  -153}, // Day 180 +23.21 deg  -3.36 min
+    {  4156,  -197}, // Day 185 +22.83 deg  -4.33 min
+    {  4058,  -235}, // Day 190 +22.29 deg  -5.17 min
+    {  3930,  -266}, // Day 195 +21.59 deg  -5.84 min
+    {  3774,  -287}, // Day 200 +20.73 deg  -6.31 min
+    {  3591,  -298}, // Day 205 +19.73 deg  -6.56 min
+    {  3384,  -298}, // Day 210 +18.59 deg  -6.55 min
+    {  3154,  -286}, // Day 215 +17.32 deg  -6.29 min
+    {  2902,  -262}, // Day 220 +15.94 deg  -5.76 min
+    {  2631,  -226}, // Day 225 +14.45 deg  -4.97 min
+    {  2343,  -179}, // Day 230 +12.87 deg  -3.92 min
+    {  2040,  -121}, // Day 235 +11.20 deg  -2.65 min
+    {  1723,   -54}, // Day 240  +9.47 deg  -1.18 min
+    {  1395,    21}, // Day 245  +7.66 deg  +0.47 min
+    {  1058,   102}, // Day 250  +5.81 deg  +2.23 min
+    {   713,   186}, // Day 255  +3.92 deg  +4.08 min
+    {   363,   271}, // Day 260  +1.99 deg  +5.96 min
+    {    10,   356}, // Day 265  +0.05 deg  +7.83 min
+    {  -345,   438}, // Day 270  -1.89 deg  +9.62 min
+    {  -698,   514}, // Day 275  -3.84 deg +11.29 min
+    { -1049,   582}, // Day 280  -5.76 deg +12.78 min
+    { -1394,   640}, // Day 285  -7.66 deg +14.07 min
+    { -1731,   687}, // Day 290  -9.51 deg +15.10 min
+    { -2058,   721}, // Day 295 -11.31 deg +15.84 min
+    { -2372,   741}, // Day 300 -13.03 deg +16.27 min
+    { -2671,   745}, // Day 305 -14.67 deg +16.37 min
+    { -2951,   734}, // Day 310 -16.21 deg +16.13 min
+    { -3211,   708}, // Day 315 -17.64 deg +15.56 min
+    { -3447,   667}, // Day 320 -18.93 deg +14.65 min
+    { -3657,   611}, // Day 325 -20.09 deg +13.43 min
+    { -3839,   542}, // Day 330 -21.09 deg +11.92 min
+    { -3991,   462}, // Day 335 -21.92 deg +10.16 min
+    { -4111,   372}, // Day 340 -22.58 deg  +8.18 min
+    { -4197,   275}, // Day 345 -23.05 deg  +6.04 min
+    { -4248,   172}, // Day 350 -23.34 deg  +3.79 min
+    { -4265,    67}, // Day 355 -23.43 deg  +1.47 min
+    { -4245,   -39}, // Day 360 -23.32 deg  -0.85 min
+    { -4191,  -142}, // Day 365 -23.02 deg  -3.13 min
+    { -4101,  -241}, // Day 370 -22.53 deg  -5.30 min
+};
+
+#endif
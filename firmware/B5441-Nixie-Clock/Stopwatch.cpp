@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Stopwatch.cpp
+ * @summary     Hundredths stopwatch with lap buffer for B5441 Nixie clock
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#include "Stopwatch.h"
+#include "Supervisor.h"
+
+extern CDisplay g_display;          // class
+extern bool IsInputSelect(void);    // Function
+extern bool IsInputUpdate(void);    // Function
+
+// Highest character of each unit for MM:SS:hh, zero for separators
+static const char digit_limit[DISPLAY_COUNT] = {'9', '9', 0, '5', '9', 0, '9', '9'};
+
+static char g_lap[STOPWATCH_LAP_COUNT][DISPLAY_COUNT];
+static uint8_t g_lap_head;
+static uint8_t g_lap_count;
+
+
+// B starts and stops, A records a lap while running or exits while stopped
+void Stopwatch(void)
+{
+    char s[DISPLAY_COUNT + 1];
+    uint32_t tick_time = 0;
+    uint32_t idle_time = millis();
+    uint32_t select_time = idle_time;
+    uint8_t remainder = 0;
+    bool running = false;
+    bool select = true; // Ignore press that entered the mode
+
+    g_lap_head = 0;
+    g_lap_count = 0;
+    strcpy_P(s, PSTR("00:00:00"));
+    g_display.SetDisplayIndicator(false);
+    g_display.SetDisplayValue(s);
+    IsInputUpdate(); // Clear any update
+
+    while (true)
+    {
+        SupervisorCheckIn(TASK_LOOP); // Mode loop replaces main loop
+        uint32_t current_time = millis();
+
+        if (running)
+        {
+            // Catch up on any hundredths missed by a slow iteration
+            while ((current_time - tick_time) >= STOPWATCH_TICK)
+            {
+                tick_time += STOPWATCH_TICK;
+
+                if (!StopwatchAdvance(s))
+                {
+                    running = false; // Hold at maximum
+                    idle_time = current_time;
+                    break;
+                }
+            }
+        }
+
+        if (IsInputUpdate())
+        {
+            running = !running;
+
+            if (running)
+            {
+                tick_time = current_time - remainder; // Resume mid-hundredth
+            }
+            else
+            {
+                remainder = current_time - tick_time;
+                idle_time = current_time;
+            }
+        }
+
+        if ((current_time - select_time) >= STOPWATCH_DEBOUNCE)
+        {
+            bool previous = select;
+            select = IsInputSelect();
+
+            if (select && !previous)
+            {
+                select_time = current_time;
+
+                if (!running)
+                {
+                    ViewLaps();
+                    return;
+                }
+
+                StopwatchLap(s);
+            }
+        }
+
+        if (!running && ((current_time - idle_time) >= STOPWATCH_IDLE))
+        {
+            return;
+        }
+    }
+}
+
+
+// Add one hundredth rewriting only the units that change
+bool StopwatchAdvance(char* s)
+{
+    for (uint8_t unit = DISPLAY_COUNT; unit--;)
+    {
+        if (digit_limit[unit] && (s[unit] < digit_limit[unit]))
+        {
+            g_display.SetUnitValue(unit, ++s[unit]);
+
+            // Clear lower units that carried
+            while (++unit < DISPLAY_COUNT)
+            {
+                if (digit_limit[unit])
+                {
+                    s[unit] = '0';
+                    g_display.SetUnitValue(unit, '0');
+                }
+            }
+
+            return true;
+        }
+    }
+
+    return false; // Overflow
+}
+
+
+void StopwatchLap(const char* s)
+{
+    memcpy(g_lap[g_lap_head], s, DISPLAY_COUNT);
+    g_lap_head = ((g_lap_head + 1) % STOPWATCH_LAP_COUNT);
+
+    if (g_lap_count < STOPWATCH_LAP_COUNT)
+    {
+        g_lap_count++;
+    }
+
+    // Show lap number - one indicator at a time
+    g_display.SetDisplayIndicator(false);
+    g_display.SetUnitIndicator(g_lap_count - 1, true);
+}
+
+
+// Browse recorded laps oldest first, B advances and A exits
+void ViewLaps(void)
+{
+    char s[DISPLAY_COUNT + 1];
+    uint8_t index = 0;
+    uint32_t timeout;
+
+    if (!g_lap_count)
+    {
+        return;
+    }
+
+    s[DISPLAY_COUNT] = '\0';
+    
+    while (IsInputSelect()); // Wait until release
+    IsInputUpdate(); // Clear any update
+
+    do
+    {
+        SupervisorCheckIn(TASK_LOOP); // Lap shown
+        uint8_t lap = ((g_lap_head + STOPWATCH_LAP_COUNT - g_lap_count + index) % STOPWATCH_LAP_COUNT);
+        memcpy(s, g_lap[lap], DISPLAY_COUNT);
+        g_display.SetDisplayIndicator(false);
+        g_display.SetUnitIndicator(index, true); // Lap number
+        g_display.SetDisplayValue(s);
+
+        if (++index >= g_lap_count)
+        {
+            index = 0;
+        }
+
+        timeout = millis();
+
+        // Wait ends by deadline so it may check in as time advances
+        while (!IsInputUpdate() && !IsInputSelect() && ((millis() - timeout) < STOPWATCH_IDLE))
+        {
+            SupervisorCheckIn(TASK_LOOP);
+        }
+    }
+    while (((millis() - timeout) < STOPWATCH_IDLE) && !IsInputSelect());
+
+    g_display.SetDisplayIndicator(false);
+}
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Stopwatch.h
+ * @summary     Hundredths stopwatch with lap buffer for B5441 Nixie clock
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#ifndef _STOPWATCH_H
+#define _STOPWATCH_H
+
+#include "B5441-Nixie-Clock.h"
+
+const uint8_t STOPWATCH_TICK = 10; // Milliseconds per hundredth
+const uint8_t STOPWATCH_LAP_COUNT = 8; // One indicator per lap
+const uint8_t STOPWATCH_DEBOUNCE = 75; // Milliseconds
+const uint16_t STOPWATCH_IDLE = 60000; // Milliseconds stopped before exit
+
+void Stopwatch(void);
+bool StopwatchAdvance(char* s);
+void StopwatchLap(const char* s);
+void ViewLaps(void);
+
+#endif
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Supervisor.cpp
+ * @summary     Task liveness watchdog for B5441 Nixie clock
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#include "Supervisor.h"
+
+extern StateStruct g_state;         // struct
+
+volatile uint8_t g_task_checkin[TASK_COUNT];
+static uint16_t g_task_remaining[TASK_COUNT] = {SUPERVISOR_LOOP_MS, SUPERVISOR_DISPLAY_MS}; // Milliseconds
+static uint8_t g_task_late = TASK_COUNT; // None
+
+extern "C" void SupervisorCrash(const uint16_t pc) __attribute__((noreturn, used));
+
+
+static uint16_t GetTaskDeadline(const uint8_t task)
+{
+    return (task == TASK_DISPLAY) ? SUPERVISOR_DISPLAY_MS : SUPERVISOR_LOOP_MS;
+}
+
+
+// Interrupt then reset after one second unless serviced
+void SupervisorEnable(void)
+{
+    uint8_t sreg = SREG;
+    cli();
+
+    // Sleep stops the millisecond service
+    for (uint8_t task = 0; task < TASK_COUNT; task++)
+    {
+        g_task_remaining[task] = GetTaskDeadline(task);
+    }
+
+    wdt_reset();
+    MCUSR &= ~_BV(WDRF); // Otherwise WDE cannot be cleared for sleep
+    WDTCSR = _BV(WDCE) | _BV(WDE); // Timed change sequence
+    WDTCSR = _BV(WDIE) | _BV(WDE) | _BV(WDP2) | _BV(WDP1); // 1 second
+    SREG = sreg;
+}
+
+
+// Called every millisecond - reset watchdog only while every task is
+// within its deadline. A check-in restarts the deadline of that task.
+void SupervisorService(void)
+{
+    // Display refresh is halted while blanked
+    if (g_state.display == State::DISABLE)
+    {
+        g_task_checkin[TASK_DISPLAY] = true;
+    }
+
+    for (uint8_t task = 0; task < TASK_COUNT; task++)
+    {
+        if (g_task_checkin[task])
+        {
+            g_task_checkin[task] = false;
+            g_task_remaining[task] = GetTaskDeadline(task);
+        }
+        else if (g_task_remaining[task])
+        {
+            g_task_remaining[task]--;
+        }
+        else if (g_task_late == TASK_COUNT)
+        {
+            g_task_late = task; // Watchdog left to expire
+        }
+    }
+
+    if (g_task_late == TASK_COUNT)
+    {
+        wdt_reset();
+    }
+}
+
+
+void GetCrashRecord(CrashRecord& record)
+{
+    eeprom_read_block(&record, reinterpret_cast<const void*>(EEPROM_CRASH), sizeof(CrashRecord));
+
+    if (record.validate != CRASH_KEY)
+    {
+        memset(&record, 0, sizeof(CrashRecord));
+    }
+}
+
+
+// Persist reason for the reset that follows - interrupts remain disabled
+void SupervisorCrash(const uint16_t pc)
+{
+    CrashRecord record;
+    GetCrashRecord(record);
+
+    record.validate = CRASH_KEY;
+    record.count++;
+    record.cause = CrashCause::WATCHDOG;
+    record.missing = 0;
+    record.late_task = g_task_late;
+    record.pc = (pc << 1); // Word to byte address
+
+    for (uint8_t task = 0; task < TASK_COUNT; task++)
+    {
+        if (!g_task_remaining[task])
+        {
+            record.missing |= _BV(task);
+        }
+    }
+
+    eeprom_update_block(&record, reinterpret_cast<void*>(EEPROM_CRASH), sizeof(CrashRecord));
+
+    while (true); // Reset on next watchdog timeout
+}
+
+
+// Interrupt-only mode wakes from sleep - reset mode means a task hung
+ISR(WDT_vect, ISR_NAKED)
+{
+    __asm__ __volatile__
+    (
+        "    push r24"              "\n\t"
+        "    lds r24, %[wdtcsr]"    "\n\t"
+        "    sbrc r24, %[wde]"      "\n\t"
+        "    rjmp 1f"               "\n\t"
+        "    pop r24"               "\n\t"
+        "    reti"                  "\n\t"
+        "1:  in r30, __SP_L__"      "\n\t"
+        "    in r31, __SP_H__"      "\n\t"
+        "    ldd r25, Z+2"          "\n\t" // Return address high byte
+        "    ldd r24, Z+3"          "\n\t" // Return address low byte
+        "    clr r1"                "\n\t"
+        "    jmp SupervisorCrash"   "\n\t"
+        :
+        : [wdtcsr] "n" (_SFR_MEM_ADDR(WDTCSR)),
+          [wde] "I" (WDE)
+    );
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Supervisor.h
+ * @summary     Task liveness watchdog for B5441 Nixie clock
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#ifndef _SUPERVISOR_H
+#define _SUPERVISOR_H
+
+#include "B5441-Nixie-Clock.h"
+
+const uint8_t CRASH_KEY = 0x5A;
+const uint16_t SUPERVISOR_LOOP_MS = 30000;   // Exceeds the longest prompt timeout
+const uint16_t SUPERVISOR_DISPLAY_MS = 100;  // Refresh interrupt runs near 500 Hz
+
+enum Task : uint8_t
+{
+    TASK_LOOP,      // Main loop and modal menus
+    TASK_DISPLAY,   // Display refresh interrupt
+    TASK_COUNT,
+};
+
+enum class CrashCause : uint8_t
+{
+    NONE,
+    WATCHDOG,   // Task missed its deadline
+};
+
+struct CrashRecord
+{
+    uint8_t     validate;
+    uint8_t     count;      // Crashes since record was created
+    CrashCause  cause;
+    uint8_t     missing;    // Bit per task past its deadline
+    uint8_t     late_task;  // First task to miss its deadline - TASK_COUNT if service stalled
+    uint16_t    pc;         // Byte address interrupted by watchdog
+};
+
+extern volatile uint8_t g_task_checkin[TASK_COUNT];
+
+// Mark task progress - single byte stores need no locking.
+// Call only where work advances, never from a wait or poll loop.
+inline void SupervisorCheckIn(const Task task)
+{
+    g_task_checkin[task] = true;
+}
+
+void SupervisorEnable(void);
+void SupervisorService(void);
+void GetCrashRecord(CrashRecord& record);
+
+#endif
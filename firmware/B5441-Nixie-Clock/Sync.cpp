@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Sync.cpp
+ * @summary     Second-edge synchronization over serial daisy chain for B5441 Nixie clock
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#include "Sync.h"
+#include "Cathode.h"
+
+extern Config g_config;             // struct
+extern CDisplay g_display;          // class
+extern CRTC::RTC* g_rtc_struct;     // struct
+extern CI2C::Handle g_rtc_device;   // struct
+
+static SyncStruct g_sync = {{{{0}, 0xFF}, {{0}, 0xFF}}, 0, 0xFF, 0, false, {0, 0, 0}, 0};
+
+
+static uint8_t ToBCD(const uint8_t value)
+{
+    return ((value / 10) << 4) | (value % 10);
+}
+
+
+// Microseconds until the millisecond compare interrupt
+static uint16_t GetTickLead(void)
+{
+    return (uint8_t)(OCR0A - TCNT0) * SYNC_COUNT_US;
+}
+
+
+// Called from USART receive - returns true when byte belongs to a marker
+bool SyncReceive(const uint8_t data)
+{
+    static SyncParserStruct parser;
+    uint8_t forward;
+    SyncByte result = SyncParse(parser, data, micros(), forward);
+
+    if (result == SyncByte::OTHER)
+    {
+        // Chain carries upstream replies too - a follower takes no commands
+        return (g_config.sync == SyncMode::FOLLOWER);
+    }
+
+    if (g_config.sync != SyncMode::FOLLOWER)
+    {
+        return true; // Discard
+    }
+
+    // Cut-through so each hop adds one byte time. Follower sends nothing
+    // else so the wait is at most the tail of the previous forwarded byte.
+    while (!(UCSR0A & _BV(UDRE0)));
+    UDR0 = forward;
+
+    if (result == SyncByte::FRAME)
+    {
+        g_sync.time[0] = parser.buffer[2];
+        g_sync.time[1] = parser.buffer[3];
+        g_sync.time[2] = parser.buffer[4];
+        g_sync.received = true;
+        SyncArm(g_sync, parser.buffer[4], GetSyncLatchDelay(parser, micros(), GetTickLead()));
+    }
+
+    return true;
+}
+
+
+// Called every millisecond - show prepared frame when countdown expires
+void SyncTick(void)
+{
+    SyncFrameStruct* frame = SyncExpire(g_sync);
+
+    for (uint8_t tube = 0; frame && (tube < DISPLAY_COUNT) && !IsCathodeExercise(); tube++)
+    {
+        g_display.SetUnitValue(tube, frame->value[tube]);
+    }
+}
+
+
+// Broadcast second edge and latch own frame after the common delay
+void SyncMaster(const CRTC::RTC& rtc, const char* s)
+{
+    uint8_t frame[SYNC_FRAME_SIZE];
+    SyncBuild(frame, rtc.hour, rtc.minute, rtc.second);
+    SyncPrepare(g_sync, rtc.second, s);
+    SyncArm(g_sync, rtc.second, GetSyncCountdown(SYNC_DELAY_MS * 1000UL, GetTickLead())); // Edge is when first byte is sent
+
+    for (uint8_t index = 0; index < SYNC_FRAME_SIZE; index++)
+    {
+        TelemetryWrite(frame[index]);
+    }
+}
+
+
+// Follower - prepare frame for next marker and keep RTC on master time
+void SyncProcess(void)
+{
+    if ((g_config.sync != SyncMode::FOLLOWER) || !g_sync.received)
+    {
+        return;
+    }
+
+    CRTC::RTC rtc = *g_rtc_struct; // Date and week day
+    g_sync.received = false;
+    g_sync.last = millis();
+    rtc.hour = g_sync.time[0];
+    rtc.minute = g_sync.time[1];
+    rtc.second = g_sync.time[2];
+
+    // Align RTC seconds chain except near midnight where date would be lost
+    if ((g_rtc_struct->second != rtc.second) && (rtc.hour || rtc.minute) &&
+        !((rtc.hour == 23) && (rtc.minute == 59)))
+    {
+        uint8_t data[] = {ToBCD(rtc.second), ToBCD(rtc.minute), ToBCD(rtc.hour)};
+        nI2C->Write(g_rtc_device, DS3232_REGISTER_TIME, data, sizeof(data));
+    }
+
+    // Seconds 0 and 30 show effects that each unit renders locally
+    if ((rtc.second != 59) && (rtc.second != 29))
+    {
+        char s[DISPLAY_COUNT + 1];
+        rtc.second++;
+        rtc.am = (rtc.hour < 12);
+        FormatRTCString(rtc, s, RTCSelect::TIME);
+
+        SyncPrepare(g_sync, rtc.second, s); // Other parity from the armed frame
+    }
+}
+
+
+// True when a latch has shown or will show this second
+bool IsSyncExpected(const uint8_t second)
+{
+    if ((millis() - g_sync.last) >= SYNC_TIMEOUT_MS)
+    {
+        return false; // Lost master
+    }
+
+    return ((g_sync.shown == second) || (g_sync.frame[second & 0x1].second == second));
+}
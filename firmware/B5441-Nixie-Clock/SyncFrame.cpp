@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        SyncFrame.cpp
+ * @summary     Sync frame parsing and latch timing for B5441 Nixie clock
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#include "SyncFrame.h"
+
+
+// Master frame with hop count zero
+void SyncBuild(uint8_t* frame, const uint8_t hour, const uint8_t minute, const uint8_t second)
+{
+    frame[0] = SYNC_MARKER;
+    frame[1] = 0;
+    frame[2] = hour;
+    frame[3] = minute;
+    frame[4] = second;
+    frame[5] = frame[1] ^ frame[2] ^ frame[3] ^ frame[4];
+}
+
+
+// Accept one received byte at now microseconds - forward is the byte to
+// pass downstream with hop count raised and check rewritten to match
+SyncByte SyncParse(SyncParserStruct& parser, const uint8_t data, const uint32_t now, uint8_t& forward)
+{
+    uint8_t* buffer = parser.buffer;
+
+    if (parser.index == 0)
+    {
+        if (data != SYNC_MARKER)
+        {
+            return SyncByte::OTHER;
+        }
+
+        parser.marker_time = now;
+    }
+
+    buffer[parser.index] = data;
+    forward = data;
+
+    if (parser.index == 1)
+    {
+        forward = data + 1; // Hop count
+    }
+    else if (parser.index == (SYNC_FRAME_SIZE - 1))
+    {
+        forward = data ^ buffer[1] ^ (buffer[1] + 1); // Check follows hop
+    }
+
+    if (++parser.index < SYNC_FRAME_SIZE)
+    {
+        return SyncByte::PART;
+    }
+
+    parser.index = 0;
+
+    if (buffer[5] != (buffer[1] ^ buffer[2] ^ buffer[3] ^ buffer[4]))
+    {
+        return SyncByte::BAD;
+    }
+
+    return SyncByte::FRAME;
+}
+
+
+// Ticks until the one nearest remaining microseconds from now - lead is
+// microseconds until the next tick. Counting from the tick phase keeps the
+// rounding of every unit unbiased instead of a fixed error per hop.
+uint8_t GetSyncCountdown(const uint32_t remaining, const uint16_t lead)
+{
+    if (remaining <= lead)
+    {
+        return 1;
+    }
+
+    return 1 + ((remaining - lead + (SYNC_TICK_US / 2)) / SYNC_TICK_US);
+}
+
+
+// Ticks from now until the common edge of the parsed frame
+uint8_t GetSyncLatchDelay(const SyncParserStruct& parser, const uint32_t now, const uint16_t lead)
+{
+    // Marker reaches hop h after (1 + h) byte times from the master edge.
+    // Time since then is measured to include late servicing of the receive.
+    uint32_t elapsed = ((1 + parser.buffer[1]) * SYNC_BYTE_US) + (now - parser.marker_time);
+    uint16_t delay = (SYNC_DELAY_MS * 1000UL) - min(elapsed, SYNC_DELAY_MS * 1000UL);
+
+    return GetSyncCountdown(delay, lead);
+}
+
+
+// Store frame for second in its parity slot - slot of other parity may be armed
+void SyncPrepare(SyncStruct& sync, const uint8_t second, const char* s)
+{
+    SyncFrameStruct& frame = sync.frame[second & 0x1];
+    frame.second = 0xFF; // Hold off latch while frame changes
+    memcpy(frame.value, s, DISPLAY_COUNT);
+    frame.second = second;
+}
+
+
+// Latch frame of second after countdown - false when none was prepared
+bool SyncArm(SyncStruct& sync, const uint8_t second, const uint8_t countdown)
+{
+    if (sync.frame[second & 0x1].second != second)
+    {
+        return false;
+    }
+
+    sync.armed = (second & 0x1);
+    sync.countdown = countdown;
+    return true;
+}
+
+
+// Called every tick - frame to show when countdown expires
+SyncFrameStruct* SyncExpire(SyncStruct& sync)
+{
+    if (!sync.countdown || --sync.countdown)
+    {
+        return nullptr;
+    }
+
+    SyncFrameStruct& frame = sync.frame[sync.armed];
+    sync.shown = frame.second;
+    frame.second = 0xFF; // Consumed
+    return &frame;
+}
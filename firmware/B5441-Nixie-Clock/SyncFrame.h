@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        SyncFrame.h
+ * @summary     Sync frame parsing and latch timing for B5441 Nixie clock
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#ifndef _SYNC_FRAME_H
+#define _SYNC_FRAME_H
+
+#include "B5441-Nixie-Clock.h"
+#include "Telemetry.h"
+
+// Frames and latches take time as arguments and touch no hardware so that
+// simulated units on a host can be chained through them
+
+const uint8_t SYNC_MARKER = 0x16; // ASCII SYN - never a telemetry command
+const uint8_t SYNC_FRAME_SIZE = 6; // Marker, hop, hour, minute, second, check
+const uint16_t SYNC_BYTE_US = (10 * 1000000UL) / TELEMETRY_BAUD; // 8N1
+const uint8_t SYNC_DELAY_MS = 20; // Master marker to latch on every unit
+const uint8_t SYNC_COUNT_US = (64 * 1000000UL) / F_CPU; // Timer0 count at 64 prescaler
+const uint16_t SYNC_TICK_US = 256 * SYNC_COUNT_US; // Timer0 compare interrupt period
+
+enum class SyncByte : uint8_t
+{
+    OTHER,  // Not part of a frame
+    PART,   // Frame continues
+    FRAME,  // Last byte of a valid frame
+    BAD,    // Last byte of a corrupted frame
+};
+
+struct SyncParserStruct
+{
+    uint8_t     buffer[SYNC_FRAME_SIZE];
+    uint8_t     index;
+    uint32_t    marker_time; // Microseconds when marker was received
+};
+
+struct SyncFrameStruct
+{
+    char                value[DISPLAY_COUNT];
+    volatile uint8_t    second;     // Second shown by value, 0xFF when none
+};
+
+struct SyncStruct
+{
+    SyncFrameStruct     frame[2];   // Indexed by second parity - next never overwrites armed
+    volatile uint8_t    armed;      // Frame latched when countdown expires
+    volatile uint8_t    shown;      // Second of last latched frame
+    volatile uint8_t    countdown;  // Milliseconds until latch, 0 when idle
+    volatile bool       received;   // Marker accepted since last process
+    volatile uint8_t    time[3];    // Hour, minute, second of last marker
+    uint32_t            last;       // millis() of last marker
+};
+
+void SyncBuild(uint8_t* frame, const uint8_t hour, const uint8_t minute, const uint8_t second);
+SyncByte SyncParse(SyncParserStruct& parser, const uint8_t data, const uint32_t now, uint8_t& forward);
+uint8_t GetSyncCountdown(const uint32_t remaining, const uint16_t lead);
+uint8_t GetSyncLatchDelay(const SyncParserStruct& parser, const uint32_t now, const uint16_t lead);
+void SyncPrepare(SyncStruct& sync, const uint8_t second, const char* s);
+bool SyncArm(SyncStruct& sync, const uint8_t second, const uint8_t countdown);
+SyncFrameStruct* SyncExpire(SyncStruct& sync);
+
+#endif
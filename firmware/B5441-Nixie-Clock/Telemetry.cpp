@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Telemetry.cpp
+ * @summary     Serial telemetry for B5441 Nixie Clock
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#include <stdarg.h>
+#include "Telemetry.h"
+#include "Memory.h"
+#include "History.h"
+#include "Supervisor.h"
+#include "Sync.h"
+#include "Provision.h"
+#include "Trace.h"
+#include "Digits.h"
+#include "Inject.h"
+
+extern uint32_t g_boot_trace[BOOT_STAGE_COUNT];
+extern ProfileStruct g_profile;
+
+static volatile uint8_t g_rx_buffer[TELEMETRY_BUFFER_SIZE];
+static volatile uint8_t g_rx_head = 0;
+static volatile uint8_t g_rx_tail = 0;
+static volatile uint8_t g_rx_reserve = 0; // Consumed bytes kept for display
+static volatile bool g_rx_xoff = false;
+static volatile uint16_t g_rx_overrun = 0; // Bytes lost to a full buffer or late read
+
+
+void TelemetryInitialize(void)
+{
+    UCSR0A = _BV(U2X0); // Double speed for lower baud error
+    UBRR0 = ((F_CPU / 8 / TELEMETRY_BAUD) - 1);
+    UCSR0C = _BV(UCSZ01) | _BV(UCSZ00); // 8N1
+    UCSR0B = _BV(RXEN0) | _BV(TXEN0) | _BV(RXCIE0);
+}
+
+
+// Cancel any XOFF still queued and let sender continue
+static void TelemetryResume(void)
+{
+    uint8_t sreg = SREG;
+    cli();
+    UCSR0B &= ~_BV(UDRIE0);
+    g_rx_xoff = false;
+    SREG = sreg;
+    TelemetryWrite(TELEMETRY_XON);
+}
+
+
+bool TelemetryAvailable(void)
+{
+    return (g_rx_head != g_rx_tail);
+}
+
+
+uint8_t TelemetryRead(void)
+{
+    uint8_t data = g_rx_buffer[g_rx_tail];
+    g_rx_tail = (g_rx_tail + 1) & (TELEMETRY_BUFFER_SIZE - 1);
+
+    // Resume sender once backlog has drained
+    if (g_rx_xoff && (TelemetryPending() <= TICKER_XON_LEVEL))
+    {
+        TelemetryResume();
+    }
+
+    return data;
+}
+
+
+// Byte already read - 1 is the most recent - valid up to reserve
+uint8_t TelemetryPeek(const uint8_t back)
+{
+    return g_rx_buffer[(g_rx_tail - back) & (TELEMETRY_BUFFER_SIZE - 1)];
+}
+
+
+uint8_t TelemetryPending(void)
+{
+    return (g_rx_head - g_rx_tail) & (TELEMETRY_BUFFER_SIZE - 1);
+}
+
+
+// Ticker keeps the last DISPLAY_COUNT bytes read as the visible window
+void TelemetryTicker(const bool enable)
+{
+    uint8_t sreg = SREG;
+    cli();
+    g_rx_tail = g_rx_head; // Discard pending commands
+
+    if (enable)
+    {
+        for (uint8_t back = 1; back <= DISPLAY_COUNT; back++)
+        {
+            g_rx_buffer[(g_rx_tail - back) & (TELEMETRY_BUFFER_SIZE - 1)] = ' ';
+        }
+
+        g_rx_reserve = DISPLAY_COUNT;
+    }
+    else
+    {
+        g_rx_reserve = 0;
+    }
+
+    SREG = sreg;
+
+    if (g_rx_xoff)
+    {
+        TelemetryResume();
+    }
+}
+
+
+// Check and store together so a queued XOFF is never overwritten
+void TelemetryWrite(const uint8_t data)
+{
+    while (true)
+    {
+        uint8_t sreg = SREG;
+        cli();
+
+        if (UCSR0A & _BV(UDRE0))
+        {
+            UDR0 = data;
+            SREG = sreg;
+            return;
+        }
+
+        SREG = sreg;
+    }
+}
+
+
+// Format string must reside in PROGMEM
+void TelemetryPrint(const char* format, ...)
+{
+    char s[TELEMETRY_LINE_SIZE];
+    va_list args;
+
+    va_start(args, format);
+    vsnprintf_P(s, sizeof(s), format, args);
+    va_end(args);
+
+    for (char* c = s; *c; c++)
+    {
+        TelemetryWrite(*c);
+    }
+}
+
+
+void TelemetryProcess(void)
+{
+    while (TelemetryAvailable())
+    {
+        switch (TelemetryRead())
+        {
+        case COMMAND_BOOT:
+            TelemetryPrint(PSTR("B"));
+
+            for (uint8_t stage = 0; stage < BOOT_STAGE_COUNT; stage++)
+            {
+                TelemetryPrint(PSTR(" %lu"), g_boot_trace[stage]);
+            }
+
+            TelemetryPrint(PSTR("\r\n"));
+            break;
+
+        case COMMAND_CONFIG:
+            ProvisionExport();
+            break;
+
+        case COMMAND_HISTORY:
+            HistoryExport();
+            break;
+
+        case COMMAND_INTERRUPT:
+            // Display refresh duration in microseconds - maximum resets on read
+            TelemetryPrint(PSTR("I last=%u max=%u budget=%u overrun=%u\r\n"),
+                           g_profile.last * PROFILE_TICK_US,
+                           g_profile.maximum * PROFILE_TICK_US,
+                           PROFILE_BUDGET * PROFILE_TICK_US,
+                           g_profile.overrun);
+            g_profile.maximum = 0;
+            break;
+
+        case COMMAND_LATENCY:
+            InjectExport();
+            break;
+
+        case COMMAND_MEMORY:
+            TelemetryPrint(PSTR("M free=%u unused=%u\r\n"), GetFreeMemory(), GetStackUnused());
+            break;
+
+        case COMMAND_RECEIVE:
+        {
+            uint8_t sreg = SREG;
+            cli();
+            uint16_t overrun = g_rx_overrun;
+            SREG = sreg;
+            TelemetryPrint(PSTR("R overrun=%u\r\n"), overrun);
+            break;
+        }
+
+        case COMMAND_NUMBER:
+            DigitsBenchmark();
+            break;
+
+        case COMMAND_PUSH:
+            ProvisionImport(false);
+            break;
+
+        case COMMAND_PROFILE:
+            ProvisionImport(true);
+            break;
+
+#if TRACE_ENABLE
+        case COMMAND_TRACE:
+            TraceExport();
+            break;
+
+#endif
+        case COMMAND_WATCHDOG:
+        {
+            CrashRecord record;
+            GetCrashRecord(record);
+            TelemetryPrint(PSTR("W count=%u cause=%u missing=%02X late=%u pc=%04X\r\n"),
+                           record.count, getValue(record.cause), record.missing,
+                           record.late_task, record.pc);
+            break;
+        }
+
+        default:
+            break; // Ignore unknown command
+        }
+    }
+}
+
+
+static void TelemetryOverrun(void)
+{
+    if (g_rx_overrun != 0xFFFF)
+    {
+        g_rx_overrun++;
+    }
+}
+
+
+ISR(USART_RX_vect)
+{
+    if (UCSR0A & _BV(DOR0))
+    {
+        TelemetryOverrun(); // Receiver lost a byte before this one
+    }
+
+    uint8_t data = UDR0;
+    uint8_t head = (g_rx_head + 1) & (TELEMETRY_BUFFER_SIZE - 1);
+    TRACE_MARK(TRACE_UART_RX, data);
+
+    if (SyncReceive(data) || InjectReceive(data))
+    {
+        return; // Marker and button bytes bypass command buffer
+    }
+
+    if (g_rx_reserve)
+    {
+        // Ticker accepts display characters only
+        if (data == '.')
+        {
+            // Light indicator of previous character unless already shown
+            if (g_rx_head != g_rx_tail)
+            {
+                g_rx_buffer[(g_rx_head - 1) & (TELEMETRY_BUFFER_SIZE - 1)] |= TICKER_INDICATOR;
+            }
+
+            return;
+        }
+        else if ((data == '\r') || (data == '\n'))
+        {
+            data = ' '; // Gap between messages
+        }
+        else if (!(((data >= '0') && (data <= ';')) || (data == ' ')))
+        {
+            return;
+        }
+
+        if ((TelemetryPending() >= TICKER_XOFF_LEVEL) && !g_rx_xoff)
+        {
+            g_rx_xoff = true;
+            UCSR0B |= _BV(UDRIE0); // Sent as soon as transmitter is free
+        }
+    }
+
+    // Discard when full - reserved window is never overwritten
+    if (((head + g_rx_reserve) & (TELEMETRY_BUFFER_SIZE - 1)) != g_rx_tail)
+    {
+        g_rx_buffer[g_rx_head] = data;
+        g_rx_head = head;
+    }
+    else
+    {
+        TelemetryOverrun();
+    }
+}
+
+
+// Queued XOFF only - other writes wait on the transmitter directly
+ISR(USART_UDRE_vect)
+{
+    UDR0 = TELEMETRY_XOFF;
+    UCSR0B &= ~_BV(UDRIE0);
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Telemetry.h
+ * @summary     Serial telemetry for B5441 Nixie Clock
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#ifndef _TELEMETRY_H
+#define _TELEMETRY_H
+
+#include "B5441-Nixie-Clock.h"
+
+const uint32_t TELEMETRY_BAUD = 57600;
+const uint8_t TELEMETRY_BUFFER_SIZE = 64; // Must be power of 2
+const uint8_t TELEMETRY_LINE_SIZE = 40;
+const uint8_t TELEMETRY_XON = 0x11;
+const uint8_t TELEMETRY_XOFF = 0x13;
+const uint8_t TICKER_XOFF_LEVEL = 24; // Leaves room for sender reaction
+const uint8_t TICKER_XON_LEVEL = 4;
+const uint8_t TICKER_INDICATOR = 0x80; // Flag on stored character
+
+enum Command : uint8_t
+{
+    COMMAND_BOOT = 'B',
+    COMMAND_CONFIG = 'C',
+    COMMAND_HISTORY = 'H',
+    COMMAND_INTERRUPT = 'I',
+    COMMAND_LATENCY = 'L',
+    COMMAND_MEMORY = 'M',
+    COMMAND_NUMBER = 'N',
+    COMMAND_PUSH = 'P',
+    COMMAND_RECEIVE = 'R',
+    COMMAND_PROFILE = 'S',
+    COMMAND_TRACE = 'T',
+    COMMAND_WATCHDOG = 'W',
+};
+
+void TelemetryInitialize(void);
+bool TelemetryAvailable(void);
+uint8_t TelemetryRead(void);
+uint8_t TelemetryPeek(const uint8_t back);
+uint8_t TelemetryPending(void);
+void TelemetryTicker(const bool enable);
+void TelemetryWrite(const uint8_t data);
+void TelemetryPrint(const char* format, ...);
+void TelemetryProcess(void);
+
+#endif
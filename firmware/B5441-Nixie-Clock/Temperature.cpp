@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Temperature.cpp
+ * @summary     Fixed-point temperature for B5441 Nixie clock
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#include "Temperature.h"
+#include "Snapshot.h"
+
+
+// Temperature in native 0.25 degree Celsius units from batched read
+int16_t GetTemperatureQuarter(void)
+{
+    return GetSnapshotTemperature();
+}
+
+
+// Convert quarter degrees Celsius to hundredths of unit
+int16_t ConvertQuarterDegree(const int16_t value, const CRTC::Unit unit)
+{
+    if (unit == CRTC::Unit::F)
+    {
+        return (value * 45) + 3200; // (q * 25) * 9 / 5 + 3200
+    }
+
+    return (value * 25);
+}
+
+
+// Render hundredths as " DDD;hh " and return true when negative
+bool FormatTemperature(char* s, const int16_t value)
+{
+    bool negative = (value < 0);
+    uint16_t magnitude = (negative ? -value : value);
+    uint16_t whole = magnitude / 100;
+    uint8_t fraction = magnitude % 100;
+
+    s[0] = ' ';
+    s[1] = '0' + (whole / 100);
+    s[2] = '0' + ((whole / 10) % 10);
+    s[3] = '0' + (whole % 10);
+    s[4] = ';';
+    s[5] = '0' + (fraction / 10);
+    s[6] = '0' + (fraction % 10);
+    s[7] = ' ';
+    s[DISPLAY_COUNT] = '\0';
+
+    return negative;
+}
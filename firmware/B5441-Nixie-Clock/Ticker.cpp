@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Ticker.cpp
+ * @summary     Serial-fed scrolling ticker for B5441 Nixie clock
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#include "Ticker.h"
+#include "Telemetry.h"
+#include "Supervisor.h"
+#include "Snapshot.h"
+#include "Countdown.h"
+#include "Cathode.h"
+
+extern CDisplay g_display;          // class
+extern volatile uint8_t g_display_frame;
+extern CRTC::RTC* g_rtc_struct;     // struct
+extern bool IsInputSelect(void);    // Function
+
+
+// Scroll one received character per display frame until A is pressed
+void Ticker(void)
+{
+    uint32_t select_time = millis();
+    uint8_t frame = g_display_frame;
+    bool select = true; // Ignore press that entered the mode
+
+    TelemetryTicker(true);
+    TickerRender();
+
+    while (true)
+    {
+        SupervisorCheckIn(TASK_LOOP); // Mode loop replaces main loop
+        uint32_t current_time = millis();
+
+        TickerService();
+
+        // Sender is paused by flow control so nothing queues beyond a frame
+        if ((frame != g_display_frame) && TelemetryAvailable())
+        {
+            frame = g_display_frame;
+            TelemetryRead();
+
+            if (!IsCathodeExercise())
+            {
+                TickerRender();
+            }
+        }
+
+        if ((current_time - select_time) >= TICKER_DEBOUNCE)
+        {
+            bool previous = select;
+            select = IsInputSelect();
+
+            if (select && !previous)
+            {
+                break;
+            }
+        }
+    }
+
+    TelemetryTicker(false);
+    g_display.SetDisplayIndicator(false);
+}
+
+
+// Main loop duties while the feed owns the tubes - alarms, timers and
+// schedules keep running and the feed is redrawn after any may draw
+void TickerService(void)
+{
+    CRTC::RTC& rtc = *g_rtc_struct; // Main loop continues from this reading
+    uint8_t previous_second = rtc.second;
+    bool drawn = AutoCountdown();
+
+    AutoBrightness();
+
+    if (SnapshotPoll(rtc) && (rtc.second != previous_second))
+    {
+        AutoSecond(rtc);
+        drawn = true;
+    }
+
+    if (drawn && !IsCathodeExercise())
+    {
+        TickerRender();
+    }
+}
+
+
+// Display the most recently read characters directly from the ring
+void TickerRender(void)
+{
+    for (uint8_t unit = 0; unit < DISPLAY_COUNT; unit++)
+    {
+        uint8_t data = TelemetryPeek(DISPLAY_COUNT - unit);
+        g_display.SetUnitValue(unit, data & ~TICKER_INDICATOR);
+        g_display.SetUnitIndicator(unit, data & TICKER_INDICATOR);
+    }
+}
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Timezone.cpp
+ * @summary     Timezone and daylight saving transitions for B5441 Nixie clock
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#include "Timezone.h"
+#include "TimezoneTable.h"
+#include "Schedule.h"
+
+extern CDS3232 g_rtc;               // class
+extern CI2C::Handle g_rtc_device;   // struct
+
+static TimezoneState g_timezone;
+static uint32_t g_next_key; // Cached from PROGMEM
+
+
+static uint8_t ToBCD(const uint8_t value)
+{
+    return ((value / 10) << 4) | (value % 10);
+}
+
+
+static uint8_t GetMonthDays(const uint8_t month, const uint8_t year)
+{
+    if (month == 2)
+    {
+        return ((year % 4) ? 28 : 29);
+    }
+
+    return (((month == 4) || (month == 6) || (month == 9) || (month == 11)) ? 30 : 31);
+}
+
+
+static void LoadTransition(void)
+{
+    g_next_key = pgm_read_dword(&timezone_table[g_timezone.index].key);
+}
+
+
+static void SaveTransition(void)
+{
+    LoadTransition();
+    eeprom_update_block(&g_timezone, reinterpret_cast<void*>(EEPROM_TIMEZONE), sizeof(TimezoneState));
+}
+
+
+// Move wall time by minutes crossing at most one day boundary
+static void ShiftMinutes(CRTC::RTC& rtc, const int16_t minutes)
+{
+    int16_t total = (rtc.hour * 60) + rtc.minute + minutes;
+
+    if (total < 0)
+    {
+        total += (24 * 60);
+        rtc.week_day = ((rtc.week_day < 2) ? 7 : (rtc.week_day - 1));
+
+        if (--rtc.day == 0)
+        {
+            if (--rtc.month == 0)
+            {
+                rtc.month = 12;
+                rtc.year--;
+            }
+
+            rtc.day = GetMonthDays(rtc.month, rtc.year);
+        }
+    }
+    else if (total >= (24 * 60))
+    {
+        total -= (24 * 60);
+        rtc.week_day = GetNextWeekDay(rtc.week_day);
+
+        if (++rtc.day > GetMonthDays(rtc.month, rtc.year))
+        {
+            rtc.day = 1;
+
+            if (++rtc.month > 12)
+            {
+                rtc.month = 1;
+                rtc.year++;
+            }
+        }
+    }
+
+    rtc.hour = total / 60;
+    rtc.minute = total % 60;
+}
+
+
+// Write all time registers in one transfer so no field can roll between them
+static void WriteRTC(const CRTC::RTC& rtc)
+{
+    uint8_t data[] =
+    {
+        ToBCD(rtc.second),
+        ToBCD(rtc.minute),
+        ToBCD(rtc.hour), // 24 hour mode
+        rtc.week_day,
+        ToBCD(rtc.day),
+        ToBCD(rtc.month),
+        ToBCD(rtc.year),
+    };
+
+    nI2C->Write(g_rtc_device, DS3232_REGISTER_TIME, data, sizeof(data));
+}
+
+
+// Fields ordered so packed values compare like the times they encode
+uint32_t PackTime(const CRTC::RTC& rtc)
+{
+    return (static_cast<uint32_t>(rtc.year) << 20) |
+           (static_cast<uint32_t>(rtc.month) << 16) |
+           (static_cast<uint32_t>(rtc.day) << 11) |
+           (static_cast<uint16_t>(rtc.hour) << 6) |
+           rtc.minute;
+}
+
+
+void TimezoneInitialize(void)
+{
+    eeprom_read_block(&g_timezone, reinterpret_cast<const void*>(EEPROM_TIMEZONE), sizeof(TimezoneState));
+
+    if (g_timezone.table_id != TIMEZONE_TABLE_ID)
+    {
+        TimezoneSeek(); // Table changed - index is meaningless
+    }
+    else
+    {
+        LoadTransition();
+    }
+}
+
+
+// Select first transition after current time - call after time is set
+void TimezoneSeek(void)
+{
+    CRTC::RTC rtc;
+    g_rtc.GetRTC(rtc);
+    uint32_t key = PackTime(rtc);
+
+    g_timezone.table_id = TIMEZONE_TABLE_ID;
+    g_timezone.index = 0;
+
+    while (pgm_read_dword(&timezone_table[g_timezone.index].key) <= key)
+    {
+        g_timezone.index++; // Table ends with unreachable key
+    }
+
+    SaveTransition();
+}
+
+
+// Apply due transitions and return true if the RTC was adjusted
+bool AutoTimezone(const CRTC::RTC& rtc)
+{
+    if (PackTime(rtc) < g_next_key)
+    {
+        return false;
+    }
+
+    CRTC::RTC local;
+    g_rtc.GetRTC(local); // Latest seconds
+
+    // Catch up on every transition passed while powered off
+    do
+    {
+        int8_t previous = ((g_timezone.index == 0) ? TIMEZONE_BASE_OFFSET :
+                           pgm_read_byte(&timezone_table[g_timezone.index - 1].offset));
+        int8_t next = pgm_read_byte(&timezone_table[g_timezone.index].offset);
+
+        ShiftMinutes(local, (next - previous) * TIMEZONE_OFFSET_MINUTES);
+        g_timezone.index++;
+        LoadTransition();
+    }
+    while (PackTime(local) >= g_next_key);
+
+    WriteRTC(local);
+    SaveTransition();
+    return true;
+}
+
+
+// Minutes local time is ahead of UTC
+int16_t GetTimezoneOffset(void)
+{
+    int8_t offset = ((g_timezone.index == 0) ? TIMEZONE_BASE_OFFSET :
+                     pgm_read_byte(&timezone_table[g_timezone.index - 1].offset));
+    return (offset * TIMEZONE_OFFSET_MINUTES);
+}
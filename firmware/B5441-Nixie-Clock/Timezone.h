@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Timezone.h
+ * @summary     Timezone and daylight saving transitions for B5441 Nixie clock
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#ifndef _TIMEZONE_H
+#define _TIMEZONE_H
+
+#include "B5441-Nixie-Clock.h"
+
+const uint8_t TIMEZONE_OFFSET_MINUTES = 15; // Minutes per offset unit
+
+struct TimezoneTransition
+{
+    uint32_t    key;    // Packed local time before change
+    int8_t      offset; // UTC offset after change
+};
+
+struct TimezoneState
+{
+    uint16_t    table_id;   // Table the index refers to
+    uint8_t     index;      // Next transition
+};
+
+uint32_t PackTime(const CRTC::RTC& rtc);
+void TimezoneInitialize(void);
+void TimezoneSeek(void);
+bool AutoTimezone(const CRTC::RTC& rtc);
+int16_t GetTimezoneOffset(void);
+
+#endif
@@ -0,0 +1,15 @@
+// Generated by tools/tzcompile.py - do not edit
+// UTC 2026-2046
+
+#ifndef _TIMEZONE_TABLE_H
+#define _TIMEZONE_TABLE_H
+
+const uint16_t TIMEZONE_TABLE_ID = 0x3C68;
+const int8_t TIMEZONE_BASE_OFFSET = 0; // Before first transition
+
+const TimezoneTransition timezone_table[] PROGMEM =
+{
+    {0xFFFFFFFF,   0}, // End
+};
+
+#endif
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Trace.cpp
+ * @summary     Timestamped event trace ring for B5441 Nixie clock
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#include "Trace.h"
+
+#if TRACE_ENABLE
+
+#include "Telemetry.h"
+
+static TraceRecord g_trace[TRACE_COUNT];
+static uint8_t g_trace_head = 0;
+static uint8_t g_trace_count = 0;
+static uint16_t g_trace_lost = 0; // Oldest records overwritten
+static uint32_t g_trace_last = 0; // Time of last record in ticks
+
+
+// Safe from any context - oldest record is overwritten when full
+void TraceRecordEvent(const uint8_t event, const uint8_t arg)
+{
+    uint8_t sreg = SREG;
+    cli();
+
+    uint32_t now = micros() / TRACE_TICK_US;
+    uint32_t wrap = (now - g_trace_last) >> 16;
+    g_trace_last = now;
+
+    for (uint8_t pass = (wrap ? 2 : 1); pass; pass--)
+    {
+        TraceRecord& record = g_trace[g_trace_head];
+        record.stamp = now;
+        record.event = (pass > 1) ? TRACE_EPOCH : event;
+        record.arg = (pass > 1) ? min(wrap, 0xFFUL) : arg;
+        g_trace_head = (g_trace_head + 1) & (TRACE_COUNT - 1);
+
+        if (g_trace_count < TRACE_COUNT)
+        {
+            g_trace_count++;
+        }
+        else
+        {
+            g_trace_lost++;
+        }
+    }
+
+    SREG = sreg;
+}
+
+
+// Drain oldest first - records added while sending wait for next export
+void TraceExport(void)
+{
+    cli();
+    uint8_t remaining = g_trace_count;
+    uint16_t lost = g_trace_lost;
+    g_trace_lost = 0;
+    sei();
+
+    TelemetryPrint(PSTR("T count=%u lost=%u\r\n"), remaining, lost);
+
+    while (remaining-- && g_trace_count)
+    {
+        TraceRecord record;
+
+        cli();
+        record = g_trace[(g_trace_head - g_trace_count) & (TRACE_COUNT - 1)];
+        g_trace_count--;
+        sei();
+
+        TelemetryPrint(PSTR("%04X %02X %02X\r\n"), record.stamp, record.event, record.arg);
+    }
+
+    TelemetryPrint(PSTR("T end\r\n"));
+}
+
+#endif
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        Trace.h
+ * @summary     Timestamped event trace ring for B5441 Nixie clock
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#ifndef _TRACE_H
+#define _TRACE_H
+
+#include "B5441-Nixie-Clock.h"
+
+// Set to 1 to record - macros compile to nothing otherwise
+#ifndef TRACE_ENABLE
+#define TRACE_ENABLE 0
+#endif
+
+// Bit per TraceEvent recorded - refresh and tick fill the ring in well
+// under a second, so they are left out unless needed
+#ifndef TRACE_MASK
+#define TRACE_MASK (0xFFFF & ~(_BV(TRACE_DISPLAY_ISR) | _BV(TRACE_TICK_ISR)))
+#endif
+
+const uint8_t TRACE_COUNT = 64; // Records - must be power of 2
+const uint8_t TRACE_TICK_US = 4; // Microseconds per timestamp unit
+const uint8_t TRACE_BEGIN_FLAG = 0x40;
+const uint8_t TRACE_END_FLAG = 0x80;
+
+enum TraceEvent : uint8_t
+{
+    TRACE_EPOCH,        // Timestamp wrapped - arg is wrap count
+    TRACE_SECOND,       // Clock face second - arg is second
+    TRACE_DISPLAY_ISR,  // Display refresh
+    TRACE_TICK_ISR,     // Millisecond tick
+    TRACE_UART_RX,      // Byte received - arg is byte
+    TRACE_I2C,          // RTC burst read - end arg is status
+    TRACE_CONFIG,       // Config EEPROM write
+    TRACE_EFFECT,       // Display effect - arg is TraceEffect
+    TRACE_BUTTON,       // Button press - arg is 0 for A, 1 for B
+    TRACE_AUDIO,        // Playback - begin arg is song index
+    TRACE_EVENT_COUNT,
+};
+
+enum TraceEffect : uint8_t
+{
+    TRACE_EFFECT_SCROLL,
+    TRACE_EFFECT_SLOT,
+    TRACE_EFFECT_TRANSITION,
+};
+
+struct TraceRecord
+{
+    uint16_t    stamp;  // Low bits of time in TRACE_TICK_US units
+    uint8_t     event;  // TraceEvent with begin or end flag
+    uint8_t     arg;
+};
+
+#if TRACE_ENABLE
+#define TRACE_EVENT(event, flag, arg) \
+    do { if (TRACE_MASK & _BV(event)) TraceRecordEvent((event) | (flag), (arg)); } while (0)
+#define TRACE_MARK(event, arg)  TRACE_EVENT(event, 0, arg)
+#define TRACE_BEGIN(event, arg) TRACE_EVENT(event, TRACE_BEGIN_FLAG, arg)
+#define TRACE_END(event, arg)   TRACE_EVENT(event, TRACE_END_FLAG, arg)
+#else
+#define TRACE_MARK(event, arg)  do {} while (0)
+#define TRACE_BEGIN(event, arg) do {} while (0)
+#define TRACE_END(event, arg)   do {} while (0)
+#endif
+
+void TraceRecordEvent(const uint8_t event, const uint8_t arg);
+void TraceExport(void);
+
+#endif
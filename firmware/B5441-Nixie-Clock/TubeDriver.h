@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 nitacku
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ *
+ * @file        TubeDriver.h
+ * @summary     Compile-time tube count and cathode map for HV5622 refresh
+ * @version     1.0
+ * @author      nitacku
+ * @data        19 October 2026
+ */
+
+#ifndef _TUBEDRIVER_H
+#define _TUBEDRIVER_H
+
+#include <stdint.h>
+
+// Every pin below count and none repeated - map is a permutation
+constexpr bool IsPinUnique(const uint8_t)
+{
+    return true;
+}
+
+template<typename... T>
+constexpr bool IsPinUnique(const uint8_t pin, const uint8_t first, const T... rest)
+{
+    return (pin != first) && IsPinUnique(pin, rest...);
+}
+
+constexpr bool IsPinMap(const uint8_t)
+{
+    return true;
+}
+
+template<typename... T>
+constexpr bool IsPinMap(const uint8_t count, const uint8_t first, const T... rest)
+{
+    return (first < count) && IsPinUnique(first, rest...) && IsPinMap(count, rest...);
+}
+
+template<uint8_t N> struct TubeIndex {};
+
+// CLOCK and SDATA are FastPin types - PINOUT gives the HV5622 output of
+// each unit value in shift order, so one board variant is one typedef
+template<typename CLOCK, typename SDATA, uint8_t TUBES, uint8_t... PINOUT>
+class CTubeDriver
+{
+public:
+    static constexpr uint8_t TUBE_COUNT = TUBES;
+    static constexpr uint8_t PIN_COUNT = sizeof...(PINOUT);
+
+    static_assert(TUBES > 0, "Board needs at least one tube");
+    static_assert(PIN_COUNT >= 10, "Pin map must cover digits 0-9");
+    static_assert(PIN_COUNT <= 16, "Pin map exceeds 16-bit tube bitmap");
+    static_assert(IsPinMap(PIN_COUNT, PINOUT...), "Pin map must use each output once");
+
+    static inline uint8_t GetPin(const uint8_t unit)
+    {
+        return pinout[unit];
+    }
+
+    // Shift every tube - bitmap(tube) is expanded inline once per tube
+    template<typename F>
+    static inline __attribute__((always_inline)) void Refresh(F bitmap)
+    {
+        ShiftTube(bitmap, TubeIndex<0>());
+    }
+
+private:
+    static const uint8_t pinout[PIN_COUNT];
+
+    template<typename F>
+    static inline __attribute__((always_inline)) void ShiftTube(F&, TubeIndex<TUBES>)
+    {
+        // Last tube shifted
+    }
+
+    template<uint8_t TUBE, typename F>
+    static inline __attribute__((always_inline)) void ShiftTube(F& bitmap, TubeIndex<TUBE>)
+    {
+        ShiftBit(bitmap(TUBE), TubeIndex<0>());
+        ShiftTube(bitmap, TubeIndex<TUBE + 1>());
+    }
+
+    static inline __attribute__((always_inline)) void ShiftBit(const uint16_t, TubeIndex<PIN_COUNT>)
+    {
+        // Last output shifted
+    }
+
+    template<uint8_t BIT>
+    static inline __attribute__((always_inline)) void ShiftBit(const uint16_t bitmap, TubeIndex<BIT>)
+    {
+        CLOCK::SetHigh();
+        SDATA::Write((bitmap >> BIT) & 0x1);
+        CLOCK::SetLow();
+        ShiftBit(bitmap, TubeIndex<BIT + 1>());
+    }
+};
+
+template<typename CLOCK, typename SDATA, uint8_t TUBES, uint8_t... PINOUT>
+const uint8_t CTubeDriver<CLOCK, SDATA, TUBES, PINOUT...>::pinout[PIN_COUNT] = {PINOUT...};
+
+#endif
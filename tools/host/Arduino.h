@@ -0,0 +1,43 @@
+// Host shim - declares only what firmware headers need to compile on a PC
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+#include <avr/interrupt.h>
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define RISING 3
+#define CHANGE 1
+#define A0 14
+#define A1 15
+#define A2 16
+#define A3 17
+#define F_CPU 16000000UL
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper*>(PSTR(s)))
+int digitalRead(uint8_t);
+void digitalWrite(uint8_t, uint8_t);
+void pinMode(uint8_t, uint8_t);
+int analogRead(uint8_t);
+void delay(unsigned long);
+void delayMicroseconds(unsigned int);
+unsigned long millis(void);
+unsigned long micros(void);
+long random(long, long);
+void attachInterrupt(uint8_t, void (*)(void), int);
+void detachInterrupt(uint8_t);
+#define digitalPinToInterrupt(p) ((p) == 2 ? 0 : 1)
+void yield(void);
+void init(void);
+#include <math.h>
+#ifndef min
+#define min(a,b) ((a)<(b)?(a):(b))
+#define max(a,b) ((a)>(b)?(a):(b))
+#define constrain(amt,low,high) ((amt)<(low)?(low):((amt)>(high)?(high):(amt)))
+#endif
@@ -0,0 +1,19 @@
+// Host shim - declares only what firmware headers need to compile on a PC
+#pragma once
+#include <Arduino.h>
+#include <nI2C.h>
+class CRTC {
+public:
+    enum class Unit : uint8_t { C, F };
+    struct RTC { uint8_t second, minute, hour; bool am; uint8_t week_day, day, month, year; };
+    float ConvertTemperature(float, Unit, Unit);
+};
+class CDS3232 : public CRTC {
+public:
+    void Initialize(void);
+    void GetRTC(RTC&);
+    uint32_t GetTimeSeconds(void);
+    float GetTemperature(void);
+    void SetTime(uint8_t, uint8_t, uint8_t);
+    void SetDate(uint8_t, uint8_t, uint8_t);
+};
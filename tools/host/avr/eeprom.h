@@ -0,0 +1,17 @@
+// Host shim - declares only what firmware headers need to compile on a PC
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#define EEMEM
+#define E2END 0x3FF
+bool eeprom_is_ready(void);
+void eeprom_read_block(void*, const void*, size_t);
+void eeprom_update_block(const void*, void*, size_t);
+void eeprom_write_block(const void*, void*, size_t);
+uint8_t eeprom_read_byte(const uint8_t*);
+void eeprom_update_byte(uint8_t*, uint8_t);
+void eeprom_write_byte(uint8_t*, uint8_t);
+uint16_t eeprom_read_word(const uint16_t*);
+void eeprom_update_word(uint16_t*, uint16_t);
+uint32_t eeprom_read_dword(const uint32_t*);
+void eeprom_update_dword(uint32_t*, uint32_t);
@@ -0,0 +1,8 @@
+// Host shim - declares only what firmware headers need to compile on a PC
+#pragma once
+#define ISR(v, ...) extern "C" void v(void)
+#define EMPTY_INTERRUPT(v) extern "C" void v(void) {}
+#define ISR_NAKED
+#define ISR_NOBLOCK
+inline void cli(void) {}
+inline void sei(void) {}
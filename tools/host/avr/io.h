@@ -0,0 +1,49 @@
+// Host shim - declares only what firmware headers need to compile on a PC
+#pragma once
+#include <stdint.h>
+#define _BV(b) (1 << (b))
+#define REG(n) extern volatile uint8_t n;
+REG(PORTB) REG(PORTC) REG(PORTD) REG(PINB) REG(PINC) REG(PIND) REG(DDRB) REG(DDRC) REG(DDRD)
+REG(OCR0A) REG(TIMSK0) REG(TCCR2A) REG(TCCR2B) REG(TCNT2) REG(OCR2A) REG(TIMSK2) REG(TIFR2) REG(TCNT0)
+REG(WDTCSR) REG(MCUSR) REG(PCICR) REG(PCMSK2) REG(PCIFR) REG(SMCR) REG(MCUCR) REG(SREG) REG(UCSR0A) REG(UCSR0B) REG(UCSR0C) REG(UDR0) REG(EIFR) REG(EIMSK) REG(PRR) REG(TCCR0A) REG(TCCR0B) REG(TIFR0) REG(ADCSRA) REG(GPIOR0)
+extern volatile uint16_t UBRR0; extern volatile uint16_t SP;
+#define RAMEND 0x8FF
+#define WGM21 1
+#define CS22 2
+#define CS21 1
+#define CS20 0
+#define OCIE2A 1
+#define OCIE0A 1
+#define OCF2A 1
+#define TOV0 0
+#define WDCE 4
+#define WDE 3
+#define WDIE 6
+#define WDIF 7
+#define WDP3 5
+#define WDRF 3
+#define BORF 2
+#define EXTRF 1
+#define PORF 0
+#define PCIE2 2
+#define PCINT18 2
+#define PCINT19 3
+#define PCIF2 2
+#define INTF0 0
+#define INTF1 1
+#define RXEN0 4
+#define TXEN0 3
+#define RXCIE0 7
+#define UDRIE0 5
+#define U2X0 1
+#define UDRE0 5
+#define DOR0 3
+#define TXC0 6
+#define UCSZ01 2
+#define UCSZ00 1
+#define SE 0
+#define _SFR_MEM_ADDR(x) 0x60
+#define _SFR_IO_ADDR(x) 0x05
+#define WDP0 0
+#define WDP1 1
+#define WDP2 2
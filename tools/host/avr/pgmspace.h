@@ -0,0 +1,18 @@
+// Host shim - declares only what firmware headers need to compile on a PC
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+#define PROGMEM
+#define PSTR(s) (s)
+typedef const char* PGM_P;
+#define pgm_read_byte(a) (*(const uint8_t*)(a))
+#define pgm_read_word(a) (*(a))
+#define pgm_read_dword(a) (*(const uint32_t*)(a))
+#define pgm_read_ptr(a) (*(a))
+#define memcpy_P memcpy
+#define strcpy_P strcpy
+#define strlen_P strlen
+#define snprintf_P snprintf
+#define strncpy_P strncpy
+#define vsnprintf_P vsnprintf
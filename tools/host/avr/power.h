@@ -0,0 +1,4 @@
+// Host shim - declares only what firmware headers need to compile on a PC
+#pragma once
+void power_adc_disable(void);
+void power_adc_enable(void);
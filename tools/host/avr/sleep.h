@@ -0,0 +1,11 @@
+// Host shim - declares only what firmware headers need to compile on a PC
+#pragma once
+#define SLEEP_MODE_IDLE 0
+#define SLEEP_MODE_PWR_SAVE 3
+#define SLEEP_MODE_PWR_DOWN 2
+void set_sleep_mode(uint8_t);
+void sleep_enable(void);
+void sleep_disable(void);
+void sleep_cpu(void);
+void sleep_bod_disable(void);
+void sleep_mode(void);
@@ -0,0 +1,75 @@
+// Host shim - declares only what firmware headers need to compile on a PC
+#pragma once
+#include <Arduino.h>
+const uint8_t DDH = 1;
+const uint8_t DDQ = 2;
+const uint8_t DE = 3;
+const uint8_t DH = 4;
+const uint8_t DQ = 5;
+const uint8_t DS = 6;
+const uint8_t DW = 7;
+const uint8_t DBLIP = 8;
+const uint8_t END = 9;
+const uint8_t NA2 = 10;
+const uint8_t NA3 = 11;
+const uint8_t NA4 = 12;
+const uint8_t NA5 = 13;
+const uint8_t NA6 = 14;
+const uint8_t NAS2 = 15;
+const uint8_t NAS3 = 16;
+const uint8_t NAS4 = 17;
+const uint8_t NAS5 = 18;
+const uint8_t NAS6 = 19;
+const uint8_t NB2 = 20;
+const uint8_t NB3 = 21;
+const uint8_t NB4 = 22;
+const uint8_t NB5 = 23;
+const uint8_t NB6 = 24;
+const uint8_t NC2 = 25;
+const uint8_t NC3 = 26;
+const uint8_t NC4 = 27;
+const uint8_t NC5 = 28;
+const uint8_t NC6 = 29;
+const uint8_t NC7 = 30;
+const uint8_t NC8 = 31;
+const uint8_t NCS4 = 32;
+const uint8_t NCS6 = 33;
+const uint8_t ND3 = 34;
+const uint8_t ND4 = 35;
+const uint8_t ND5 = 36;
+const uint8_t ND6 = 37;
+const uint8_t ND7 = 38;
+const uint8_t NDS6 = 39;
+const uint8_t NE3 = 40;
+const uint8_t NE4 = 41;
+const uint8_t NE5 = 42;
+const uint8_t NE6 = 43;
+const uint8_t NF3 = 44;
+const uint8_t NF4 = 45;
+const uint8_t NF5 = 46;
+const uint8_t NF6 = 47;
+const uint8_t NG2 = 48;
+const uint8_t NG3 = 49;
+const uint8_t NG4 = 50;
+const uint8_t NG5 = 51;
+const uint8_t NG6 = 52;
+const uint8_t NGS4 = 53;
+const uint8_t NGS5 = 54;
+const uint8_t NGS6 = 55;
+const uint8_t NRS = 56;
+const uint8_t NS0 = 57;
+const uint8_t NS1 = 58;
+const uint8_t NS2 = 59;
+const uint8_t NS3 = 60;
+const uint8_t NS4 = 61;
+const uint8_t NS5 = 62;
+const uint8_t NS6 = 63;
+const uint8_t NS7 = 64;
+class CAudio {
+public:
+    enum class Functions : uint8_t { MemStream, PGMStream };
+    CAudio(uint8_t, uint8_t) {}
+    void Play(Functions, const uint8_t*, const uint8_t*) {}
+    void Stop(void) {}
+    bool IsActive(void) { return false; }
+};
@@ -0,0 +1,36 @@
+// Host shim - declares only what firmware headers need to compile on a PC
+#pragma once
+#include <Arduino.h>
+typedef const __FlashStringHelper* type_array;
+typedef uint8_t type_item;
+class CDisplay {
+public:
+    enum class Brightness : uint8_t { AUTO, MIN = 0, L1, L2, L3, L4, L5, L6, L7, L8, MAX = 8 };
+    enum class Mode : uint8_t { STATIC, SCROLL };
+    enum class Direction : uint8_t { LEFT, RIGHT };
+    enum class Event : uint8_t { DECREMENT, INCREMENT, SELECTION, TIMEOUT };
+    struct PromptSelectStruct { uint8_t item_count = 0; uint8_t initial_selection = 0; Mode display_mode = Mode::STATIC; type_array title = nullptr; type_array* item_array = nullptr; };
+    struct PromptValueStruct { uint8_t item_count = 0; Brightness brightness_min = Brightness::MIN; const uint8_t* item_position = nullptr; const uint8_t* item_digit_count = nullptr; type_item* item_value = nullptr; const type_item* item_lower_limit = nullptr; const type_item* item_upper_limit = nullptr; const char* initial_display = nullptr; type_array title = nullptr; };
+    CDisplay(uint8_t) {}
+    void SetCallbackIsIncrement(bool (*)(void));
+    void SetCallbackIsSelect(bool (*)(void));
+    void SetCallbackIsUpdate(bool (*)(void));
+    void SetDisplayBrightness(Brightness);
+    void SetDisplayValue(const char*);
+    void SetDisplayValue(const __FlashStringHelper*);
+    void SetDisplayValue(uint32_t);
+    void GetDisplayValue(char*);
+    void SetUnitValue(uint8_t, char);
+    char GetUnitValue(uint8_t);
+    Brightness GetUnitBrightness(uint8_t);
+    uint16_t GetUnitIndicator(uint8_t);
+    void SetUnitIndicator(uint8_t, bool);
+    void SetDisplayIndicator(bool);
+    void EffectScroll(const char*, Direction, uint8_t);
+    void EffectScroll(const __FlashStringHelper*, Direction, uint8_t);
+    void EffectSlotMachine(uint8_t);
+    int8_t PromptSelect(PromptSelectStruct&, uint32_t, bool (*)(Event, uint8_t) = nullptr);
+    template<typename T> int8_t PromptSelect(PromptSelectStruct&, uint32_t, T);
+    int8_t PromptValue(PromptValueStruct&, uint32_t, bool (*)(Event, uint8_t) = nullptr);
+    template<typename T> int8_t PromptValue(PromptValueStruct&, uint32_t, T);
+};
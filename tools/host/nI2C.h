@@ -0,0 +1,12 @@
+// Host shim - declares only what firmware headers need to compile on a PC
+#pragma once
+#include <Arduino.h>
+class CI2C {
+public:
+    enum class Speed : uint8_t { SLOW, FAST };
+    struct Handle { uint8_t device_address; };
+    Handle RegisterDevice(uint8_t, uint8_t, Speed);
+    uint8_t Read(const Handle&, uint32_t, uint8_t*, uint32_t, void (*)(const uint8_t) = nullptr);
+    uint8_t Write(const Handle&, uint32_t, const uint8_t*, uint32_t, void (*)(const uint8_t) = nullptr);
+};
+extern CI2C* nI2C;
@@ -0,0 +1,5 @@
+// Host shim - declares only what firmware headers need to compile on a PC
+#pragma once
+#define ATOMIC_RESTORESTATE 0
+#define ATOMIC_FORCEON 1
+#define ATOMIC_BLOCK(x) for (int _i = 0; _i < 1; _i++)
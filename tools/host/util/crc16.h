@@ -0,0 +1,6 @@
+// Host shim - declares only what firmware headers need to compile on a PC
+#pragma once
+#include <stdint.h>
+uint16_t _crc16_update(uint16_t, uint8_t);
+uint16_t _crc_ccitt_update(uint16_t, uint8_t);
+uint16_t _crc_xmodem_update(uint16_t, uint8_t);
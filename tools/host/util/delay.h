@@ -0,0 +1,3 @@
+// Host shim - declares only what firmware headers need to compile on a PC
+#pragma once
+void _delay_us(double);
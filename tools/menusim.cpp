@@ -0,0 +1,752 @@
+//
+// Copyright (c) 2026 nitacku
+//
+// Replay scripted button presses through the B5441 Nixie clock menus on a
+// PC and report input-to-display latency per menu path. The firmware's
+// Menu.cpp and Label.cpp run unchanged on virtual time, and its Inject.cpp
+// receives the presses and times them as it does on the clock.
+//
+// build: g++ -std=gnu++11 -O2 -I tools/host tools/menusim.cpp -o menusim
+//
+// usage: menusim SCRIPT [REPEAT] [SEED]
+//
+// SCRIPT is the format read by tools/replay.py. Each run starts at a
+// random phase of the idle loop, display refresh and millisecond tick,
+// and each step is offset by up to a millisecond as a host would be.
+//
+// Virtual time advances only where the firmware waits: delay(), each poll
+// of IsInputSelect() or IsInputUpdate(), and the effects and prompts of
+// the display library. The nDisplay library is not part of this tree, so
+// its prompts and effects are modelled below from how Menu.cpp calls
+// them. The model shows an item once per press and does not blink.
+// Latency therefore covers the menu code's own waits and effects but not
+// its CPU time, nor library behaviour beyond this model. DivergenceMeter,
+// Stopwatch, Ticker and Detonate live outside Menu.cpp and return at once.
+
+#include <algorithm>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <Arduino.h> // Shim from tools/host - after std headers as it defines min and max
+#include <nDisplay.h>
+
+// Firmware source compiled into this unit unchanged
+#include "../firmware/B5441-Nixie-Clock/Menu.cpp"
+#include "../firmware/B5441-Nixie-Clock/Label.cpp"
+#include "../firmware/B5441-Nixie-Clock/Inject.cpp"
+
+static const uint32_t TICK_US = 1024; // Timer0 compare interrupt
+static const uint32_t PHASE_US = 1024UL * (INTERRUPT_FAST + 1) * 1000000 / F_CPU; // Refresh phase
+static const uint32_t POLL_US = 2; // Input poll with loop overhead and interrupt load
+static const uint32_t PROMPT_STEP_MS = 10; // Prompt loop period - timeouts count these
+static const uint8_t SCROLL_MS = 80; // Scroll step of prompt items and titles
+static const uint32_t IDLE_MS = 50; // Main loop idle delay
+static const uint32_t JITTER_US = 1000; // Most host timing error per step
+static const uint64_t RETURN_LIMIT_US = 600000000; // Path must return to clock display
+
+struct Step
+{
+    uint8_t     button; // Inject byte or zero to wait
+    uint32_t    delay;  // Milliseconds before next step
+};
+
+struct Path
+{
+    std::string         name;
+    std::vector<Step>   steps;
+};
+
+struct Press
+{
+    uint64_t    time;
+    uint8_t     button;
+};
+
+static std::mt19937 g_random;
+static uint64_t g_now; // Virtual microseconds
+static uint64_t g_tick_next;
+static uint64_t g_frame_next;
+static uint64_t g_limit;
+static std::vector<Press> g_press;
+static size_t g_press_next;
+
+// Display held by the modelled library
+static char g_unit_value[DISPLAY_COUNT];
+static bool g_unit_indicator[DISPLAY_COUNT];
+static CDisplay::Brightness g_brightness;
+static bool (*g_callback_is_select)(void);
+static bool (*g_callback_is_update)(void);
+
+// Firmware globals defined by B5441-Nixie-Clock.ino on the clock
+StateStruct g_state;
+Config g_config;
+CDS3232 g_rtc;
+CAudio g_audio{0, 0};
+CDisplay g_display{DISPLAY_COUNT};
+uint8_t g_song_entries = INBUILT_SONG_COUNT;
+volatile bool g_button_update = false;
+volatile uint8_t g_task_checkin[TASK_COUNT];
+volatile uint8_t SREG;
+
+
+static uint32_t Random(const uint32_t limit)
+{
+    return std::uniform_int_distribution<uint32_t>(0, limit - 1)(g_random);
+}
+
+
+// Run interrupts and injected presses due within the next us microseconds
+static void Advance(const uint32_t us)
+{
+    uint64_t until = g_now + us;
+
+    while (true)
+    {
+        uint64_t press = (g_press_next < g_press.size()) ? g_press[g_press_next].time : UINT64_MAX;
+        uint64_t next = min(min(g_tick_next, g_frame_next), press);
+
+        if (next > until)
+        {
+            break;
+        }
+
+        g_now = next;
+
+        if (next == g_tick_next)
+        {
+            InjectTick();
+            g_tick_next += TICK_US;
+        }
+        else if (next == g_frame_next)
+        {
+            InjectFrame();
+            g_frame_next += PHASE_US;
+        }
+        else
+        {
+            InjectReceive(g_press[g_press_next++].button);
+        }
+    }
+
+    g_now = until;
+
+    if (g_now > g_limit)
+    {
+        printf("path does not return to the clock display\n");
+        exit(1);
+    }
+}
+
+
+//---------------------------------------------------------------------
+// Arduino core on virtual time
+//---------------------------------------------------------------------
+
+void delay(unsigned long ms)
+{
+    Advance(ms * 1000);
+}
+
+
+void delayMicroseconds(unsigned int us)
+{
+    Advance(us);
+}
+
+
+// Wrap at 32 bits as on the clock
+unsigned long millis(void)
+{
+    return static_cast<uint32_t>(g_now / 1000);
+}
+
+
+unsigned long micros(void)
+{
+    return static_cast<uint32_t>(g_now);
+}
+
+
+//---------------------------------------------------------------------
+// Display library model
+//---------------------------------------------------------------------
+
+static void ShowValue(const char* s)
+{
+    size_t length = strlen(s);
+
+    for (uint8_t tube = 0; tube < DISPLAY_COUNT; tube++)
+    {
+        g_unit_value[tube] = (tube < length) ? s[tube] : ' ';
+    }
+}
+
+
+void CDisplay::SetCallbackIsIncrement(bool (*)(void)) {}
+void CDisplay::SetCallbackIsSelect(bool (*callback)(void)) { g_callback_is_select = callback; }
+void CDisplay::SetCallbackIsUpdate(bool (*callback)(void)) { g_callback_is_update = callback; }
+void CDisplay::SetDisplayBrightness(Brightness brightness) { g_brightness = brightness; }
+void CDisplay::SetDisplayValue(const char* s) { ShowValue(s); }
+void CDisplay::SetDisplayValue(const __FlashStringHelper* s) { ShowValue(reinterpret_cast<const char*>(s)); }
+void CDisplay::SetUnitValue(uint8_t tube, char value) { g_unit_value[tube] = value; }
+char CDisplay::GetUnitValue(uint8_t tube) { return g_unit_value[tube]; }
+CDisplay::Brightness CDisplay::GetUnitBrightness(uint8_t) { return g_brightness; }
+uint16_t CDisplay::GetUnitIndicator(uint8_t tube) { return g_unit_indicator[tube]; }
+void CDisplay::SetUnitIndicator(uint8_t tube, bool state) { g_unit_indicator[tube] = state; }
+
+
+void CDisplay::SetDisplayValue(uint32_t value)
+{
+    char s[16];
+    snprintf(s, sizeof(s), "%*lu", DISPLAY_COUNT, static_cast<unsigned long>(value));
+    ShowValue(s);
+}
+
+
+void CDisplay::GetDisplayValue(char* s)
+{
+    memcpy(s, g_unit_value, DISPLAY_COUNT);
+    s[DISPLAY_COUNT] = '\0';
+}
+
+
+void CDisplay::SetDisplayIndicator(bool state)
+{
+    for (uint8_t tube = 0; tube < DISPLAY_COUNT; tube++)
+    {
+        g_unit_indicator[tube] = state;
+    }
+}
+
+
+// Text enters from one side a tube per step until it fills the display
+void CDisplay::EffectScroll(const char* s, Direction direction, uint8_t speed)
+{
+    size_t length = strlen(s);
+
+    for (uint8_t step = 0; step < DISPLAY_COUNT; step++)
+    {
+        if (direction == Direction::LEFT)
+        {
+            memmove(g_unit_value, g_unit_value + 1, DISPLAY_COUNT - 1);
+            g_unit_value[DISPLAY_COUNT - 1] = (step < length) ? s[step] : ' ';
+        }
+        else
+        {
+            uint8_t index = DISPLAY_COUNT - 1 - step;
+            memmove(g_unit_value + 1, g_unit_value, DISPLAY_COUNT - 1);
+            g_unit_value[0] = (index < length) ? s[index] : ' ';
+        }
+
+        delay(speed);
+    }
+}
+
+
+void CDisplay::EffectScroll(const __FlashStringHelper* s, Direction direction, uint8_t speed)
+{
+    EffectScroll(reinterpret_cast<const char*>(s), direction, speed);
+}
+
+
+// Digits spin and settle from left to right on the value already set
+void CDisplay::EffectSlotMachine(uint8_t speed)
+{
+    char value[DISPLAY_COUNT];
+    memcpy(value, g_unit_value, DISPLAY_COUNT);
+
+    for (uint8_t step = 0; step < (2 * DISPLAY_COUNT); step++)
+    {
+        for (uint8_t tube = (step / 2); tube < DISPLAY_COUNT; tube++)
+        {
+            g_unit_value[tube] = '0' + ((step + tube) % 10);
+        }
+
+        for (uint8_t tube = 0; tube < (step / 2); tube++)
+        {
+            g_unit_value[tube] = value[tube];
+        }
+
+        delay(speed);
+    }
+
+    memcpy(g_unit_value, value, DISPLAY_COUNT);
+}
+
+
+// Pressed since last poll of this prompt - a held select is not a new choice
+static bool IsSelectEdge(bool& previous)
+{
+    bool current = g_callback_is_select();
+    bool edge = (current && !previous);
+    previous = current;
+    return edge;
+}
+
+
+static void ShowItem(const CDisplay::PromptSelectStruct& prompt, const uint8_t selection)
+{
+    const char* s = reinterpret_cast<const char*>(prompt.item_array[selection]);
+
+    if (prompt.display_mode == CDisplay::Mode::SCROLL)
+    {
+        g_display.EffectScroll(s, CDisplay::Direction::LEFT, SCROLL_MS);
+    }
+    else
+    {
+        ShowValue(s);
+    }
+}
+
+
+template<typename T>
+int8_t CDisplay::PromptSelect(PromptSelectStruct& prompt, uint32_t timeout, T callback)
+{
+    uint8_t selection = prompt.initial_selection;
+    bool previous = true; // Press that opened prompt
+    uint32_t idle = 0;
+
+    if (prompt.title)
+    {
+        EffectScroll(prompt.title, Direction::LEFT, SCROLL_MS);
+    }
+
+    ShowItem(prompt, selection);
+
+    while (true)
+    {
+        if (IsSelectEdge(previous))
+        {
+            callback(Event::SELECTION, selection);
+            return selection;
+        }
+
+        if (g_callback_is_update())
+        {
+            selection = ((selection + 1) % prompt.item_count);
+            callback(Event::INCREMENT, selection);
+            ShowItem(prompt, selection);
+            idle = 0;
+            continue;
+        }
+
+        if (++idle >= timeout)
+        {
+            if (!callback(Event::TIMEOUT, selection))
+            {
+                return -1;
+            }
+
+            idle = 0;
+        }
+
+        delay(PROMPT_STEP_MS);
+    }
+}
+
+
+int8_t CDisplay::PromptSelect(PromptSelectStruct& prompt, uint32_t timeout, bool (*callback)(Event, uint8_t))
+{
+    return PromptSelect(prompt, timeout, [callback](Event event, uint8_t selection) -> bool
+    {
+        return (callback && callback(event, selection));
+    });
+}
+
+
+static void ShowItemValue(const CDisplay::PromptValueStruct& prompt, const uint8_t item)
+{
+    char s[8];
+    uint8_t count = prompt.item_digit_count[item];
+    snprintf(s, sizeof(s), "%0*u", count, prompt.item_value[item]);
+    memcpy(&g_unit_value[prompt.item_position[item]], s + strlen(s) - count, count);
+}
+
+
+// Each item counts up to its limit and wraps, select moves to the next
+template<typename T>
+int8_t CDisplay::PromptValue(PromptValueStruct& prompt, uint32_t timeout, T callback)
+{
+    uint8_t item = 0;
+    bool previous = true; // Press that opened prompt
+    uint32_t idle = 0;
+
+    if (prompt.title)
+    {
+        EffectScroll(prompt.title, Direction::LEFT, SCROLL_MS);
+    }
+
+    ShowValue(prompt.initial_display);
+
+    for (uint8_t index = 0; index < prompt.item_count; index++)
+    {
+        ShowItemValue(prompt, index);
+    }
+
+    while (true)
+    {
+        if (IsSelectEdge(previous))
+        {
+            callback(Event::SELECTION, prompt.item_value[item]);
+
+            if (++item >= prompt.item_count)
+            {
+                return 0;
+            }
+
+            idle = 0;
+            continue;
+        }
+
+        if (g_callback_is_update())
+        {
+            type_item& value = prompt.item_value[item];
+            value = (value >= prompt.item_upper_limit[item]) ? prompt.item_lower_limit[item] : (value + 1);
+            ShowItemValue(prompt, item);
+            callback(Event::INCREMENT, value);
+            idle = 0;
+            continue;
+        }
+
+        if (++idle >= timeout)
+        {
+            if (!callback(Event::TIMEOUT, prompt.item_value[item]))
+            {
+                return -1;
+            }
+
+            idle = 0;
+        }
+
+        delay(PROMPT_STEP_MS);
+    }
+}
+
+
+int8_t CDisplay::PromptValue(PromptValueStruct& prompt, uint32_t timeout, bool (*callback)(Event, uint8_t))
+{
+    return PromptValue(prompt, timeout, [callback](Event event, uint8_t selection) -> bool
+    {
+        return (callback && callback(event, selection));
+    });
+}
+
+
+//---------------------------------------------------------------------
+// Clock services outside the menus - fixed values, no hardware
+//---------------------------------------------------------------------
+
+// Virtual time from 12:34:00 on 19 October 2026
+void CDS3232::GetRTC(RTC& rtc)
+{
+    uint32_t seconds = (12 * 3600UL) + (34 * 60) + (g_now / 1000000);
+    rtc = RTC{static_cast<uint8_t>(seconds % 60), static_cast<uint8_t>((seconds / 60) % 60),
+              static_cast<uint8_t>((seconds / 3600) % 24), false, 1, 19, 10, 26};
+}
+
+
+void CDS3232::SetTime(uint8_t, uint8_t, uint8_t) {}
+void CDS3232::SetDate(uint8_t, uint8_t, uint8_t) {}
+
+void DivergenceMeter(void) {}
+void Stopwatch(void) {}
+void Ticker(void) {}
+void Detonate(void) {}
+void PlayMusic(const uint8_t) {}
+void DisplayState(State state) { g_state.display = state; }
+void VoltageState(State state) { g_state.voltage = state; }
+void InterruptSpeed(const uint8_t) {}
+void UpdateBlankSchedule(void) {}
+void SetConfig(const Config&) {}
+void ApplyConfig(const Config&) {}
+bool GetProfile(Config&) { return false; }
+void TimezoneSeek(void) {}
+void TelemetryPrint(const char*, ...) {}
+CDisplay::Brightness ReadLightIntensity(void) { return CDisplay::Brightness::L4; }
+int16_t GetTemperatureQuarter(void) { return 80; }
+int16_t ConvertQuarterDegree(const int16_t value, const CRTC::Unit) { return value; }
+bool IsCountdownActive(void) { return false; }
+bool IsCountdownActive(const uint8_t) { return false; }
+uint32_t GetCountdownRemaining(const uint8_t) { return 0; }
+int8_t CountdownStart(const uint32_t) { return 0; }
+void CountdownCancel(const uint8_t) {}
+uint32_t GetCathodeUnits(const uint8_t, const uint8_t) { return 0; }
+bool GetHistorySummary(const HistoryWindow, const uint32_t, HistorySummary&) { return false; }
+uint32_t GetHourStamp(const CRTC::RTC&) { return 0; }
+uint16_t GetFreeMemory(void) { return 0; }
+uint16_t GetStackUnused(void) { return 0; }
+uint8_t FormatHour(const uint8_t hour) { return hour; }
+
+
+bool FormatTemperature(char* s, const int16_t value)
+{
+    snprintf(s, DISPLAY_COUNT + 1, "  %4d  ", value / 4);
+    return (value < 0);
+}
+
+
+void FormatRTCString(const CRTC::RTC& rtc, char* s, const RTCSelect type)
+{
+    if (type == RTCSelect::TIME)
+    {
+        snprintf(s, DISPLAY_COUNT + 1, "%02u %02u %02u", rtc.hour, rtc.minute, rtc.second);
+    }
+    else
+    {
+        snprintf(s, DISPLAY_COUNT + 1, "%02u %02u %02u", rtc.day, rtc.month, rtc.year);
+    }
+}
+
+
+uint32_t GetSeconds(const uint8_t hour, const uint8_t minute, const uint8_t second)
+{
+    return (static_cast<uint32_t>(hour) * 3600) + (minute * 60) + second;
+}
+
+
+//---------------------------------------------------------------------
+// Inputs and main loop as in B5441-Nixie-Clock.ino, without button pins
+//---------------------------------------------------------------------
+
+bool IsInputIncrement(void)
+{
+    return true; // Always increment
+}
+
+
+bool IsInputSelect(void)
+{
+    static bool previous_value = false;
+    Advance(POLL_US);
+    bool current_value = IsInjectSelect();
+
+    if (current_value && !previous_value)
+    {
+        SupervisorCheckIn(TASK_LOOP);
+        InjectConsume(INJECT_BUTTON_A);
+    }
+
+    previous_value = current_value;
+    return current_value;
+}
+
+
+bool IsInputUpdate(void)
+{
+    Advance(POLL_US);
+    bool current_value = g_button_update;
+    g_button_update = false; // Reset
+
+    if (current_value)
+    {
+        SupervisorCheckIn(TASK_LOOP); // Prompt handles a press
+        InjectConsume(INJECT_BUTTON_B);
+    }
+
+    return current_value;
+}
+
+
+// Clock face and input dispatch of loop() - second effects are not shown
+static void LoopStep(void)
+{
+    static uint8_t button_timeout = 0;
+    static uint8_t previous_second = 0xFF;
+    CRTC::RTC rtc;
+    g_rtc.GetRTC(rtc);
+
+    if (rtc.second != previous_second)
+    {
+        char s[DISPLAY_COUNT + 1];
+        previous_second = rtc.second;
+        FormatRTCString(rtc, s, RTCSelect::TIME);
+        g_display.SetDisplayValue(s);
+    }
+
+    if (IsInputUpdate() || IsInputSelect())
+    {
+        if (button_timeout == 0)
+        {
+            g_display.SetDisplayIndicator(false);
+
+            if (IsInputSelect())
+            {
+                char s[DISPLAY_COUNT + 1];
+                FormatRTCString(rtc, s, RTCSelect::DATE);
+                g_display.SetDisplayValue(s);
+                MenuInfo();
+            }
+            else
+            {
+                MenuSettings();
+            }
+        }
+
+        button_timeout = 10;
+    }
+
+    if (button_timeout)
+    {
+        button_timeout--;
+    }
+
+    delay(IDLE_MS);
+}
+
+
+//---------------------------------------------------------------------
+// Replay
+//---------------------------------------------------------------------
+
+static std::vector<Path> Parse(const char* file)
+{
+    std::vector<Path> paths;
+    std::ifstream input(file);
+    std::string line;
+    uint32_t number = 0;
+
+    if (!input)
+    {
+        printf("cannot open %s\n", file);
+        exit(1);
+    }
+
+    while (std::getline(input, line))
+    {
+        std::istringstream fields(line.substr(0, line.find('#')));
+        std::string word;
+        std::string value;
+        std::string extra;
+        number++;
+
+        if (!(fields >> word))
+        {
+            continue;
+        }
+
+        if (!(fields >> value) || (fields >> extra))
+        {
+            value.clear(); // Two fields only
+        }
+
+        if ((word == "path") && !value.empty())
+        {
+            paths.push_back(Path{value, {}});
+        }
+        else if (((word == "A") || (word == "B") || (word == "wait")) && !value.empty() && !paths.empty())
+        {
+            uint8_t button = (word == "A") ? INJECT_BUTTON_A : ((word == "B") ? INJECT_BUTTON_B : 0);
+            paths.back().steps.push_back(Step{button, static_cast<uint32_t>(atol(value.c_str()))});
+        }
+        else
+        {
+            printf("%s:%u: bad step '%s'\n", file, number, line.c_str());
+            exit(1);
+        }
+    }
+
+    return paths;
+}
+
+
+// Play steps from the clock display and run until it is shown again
+static void Run(const Path& path)
+{
+    uint64_t time = g_now + Random(IDLE_MS * 1000);
+    g_press.clear();
+    g_press_next = 0;
+
+    for (const Step& step : path.steps)
+    {
+        time += Random(JITTER_US);
+
+        if (step.button)
+        {
+            g_press.push_back(Press{time, step.button});
+        }
+
+        time += step.delay * 1000;
+    }
+
+    g_limit = time + RETURN_LIMIT_US;
+
+    while (g_now < time)
+    {
+        LoopStep(); // Returns only at the clock display
+    }
+
+    if (g_inject.pending)
+    {
+        InjectRecord(INJECT_NO_CHANGE); // Last press never answered
+    }
+}
+
+
+static double Percentile(std::vector<double> values, const uint32_t rank)
+{
+    std::sort(values.begin(), values.end());
+    size_t index = ((values.size() * rank) + 99) / 100; // Nearest rank
+    return values[max(index, static_cast<size_t>(1)) - 1];
+}
+
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        printf("usage: menusim SCRIPT [REPEAT] [SEED]\n");
+        return 1;
+    }
+
+    std::vector<Path> paths = Parse(argv[1]);
+    uint32_t repeat = (argc > 2) ? atol(argv[2]) : 100;
+    g_random.seed((argc > 3) ? atol(argv[3]) : 1);
+
+    g_display.SetCallbackIsIncrement(IsInputIncrement);
+    g_display.SetCallbackIsSelect(IsInputSelect);
+    g_display.SetCallbackIsUpdate(IsInputUpdate);
+    g_state.display = State::ENABLE;
+    g_tick_next = Random(TICK_US);
+    g_frame_next = Random(PHASE_US);
+
+    printf("%-16s %6s %6s %8s %8s %8s\n", "path", "inputs", "missed", "p50 ms", "p99 ms", "max ms");
+
+    for (const Path& path : paths)
+    {
+        std::vector<double> latency;
+        uint32_t missed = 0;
+
+        for (uint32_t run = 0; run < repeat; run++)
+        {
+            Run(path);
+
+            for (uint8_t index = 0; index < g_inject.count; index++)
+            {
+                if (g_inject.result[index] == INJECT_NO_CHANGE)
+                {
+                    missed++;
+                }
+                else
+                {
+                    latency.push_back(g_inject.result[index] / 10.0); // Milliseconds
+                }
+            }
+
+            g_inject.count = 0;
+        }
+
+        if (latency.empty())
+        {
+            printf("%-16s %6u %6u %8s %8s %8s\n", path.name.c_str(), missed, missed, "-", "-", "-");
+        }
+        else
+        {
+            printf("%-16s %6zu %6u %8.1f %8.1f %8.1f\n", path.name.c_str(), latency.size() + missed, missed,
+                   Percentile(latency, 50), Percentile(latency, 99), Percentile(latency, 100));
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,215 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 nitacku
+#
+# Pull, diff and push the B5441 Nixie clock Config over its UART.
+#
+# usage: provision.py PORT pull [--output FILE]
+#        provision.py PORT diff FILE
+#        provision.py PORT push FILE [--profile]
+#
+# Files are JSON with one entry per Config field. push writes the live
+# Config, push --profile writes the site profile restored by the RESET
+# menu. Requires pyserial.
+
+import argparse
+import binascii
+import json
+import struct
+import sys
+import time
+
+import serial
+
+BAUD = 57600
+TIMEOUT = 0.5  # Seconds
+READY_TIMEOUT = 10  # Seconds for a menu or effect on the clock to end
+RESULT_TIMEOUT = 2  # Seconds for validation and EEPROM write
+PUSH_ATTEMPTS = 3
+
+# Must match ProvisionResult in Provision.h
+RESULTS = {0: "ok", 1: "format", 2: "version", 3: "crc", 4: "range"}
+RETRY_RESULTS = (1, 3)  # Transport errors
+
+# Must match CONFIG_KEY and struct Config in B5441-Nixie-Clock.h
+CONFIG_KEY = ord("'")
+ALARM_COUNT = 3
+BLANK_WINDOW_COUNT = 3
+
+FIELDS = [
+    ("validate", "B"),
+    ("noise", "B"),
+    ("alarm_state", "B"),
+    ("brightness", "B"),
+    ("gain", "B"),
+    ("offset", "B"),
+    ("date_format", "B"),
+    ("time_format", "B"),
+    ("temperature_unit", "B"),
+    ("music_timer", "B"),
+]
+
+for index in range(ALARM_COUNT):
+    FIELDS += [
+        ("alarm%d.state" % index, "B"),
+        ("alarm%d.music" % index, "B"),
+        ("alarm%d.days" % index, "B"),
+        ("alarm%d.time" % index, "I"),
+    ]
+
+for index in range(BLANK_WINDOW_COUNT):
+    FIELDS += [
+        ("blank%d.days" % index, "B"),
+        ("blank%d.begin" % index, "H"),
+        ("blank%d.end" % index, "H"),
+    ]
+
+FIELDS += [
+    ("solar", "B"),
+    ("latitude", "h"),  # Tenths of degree, north positive
+    ("longitude", "h"),  # Tenths of degree, east positive
+    ("sync", "B"),
+]
+
+LAYOUT = "<" + "".join(kind for name, kind in FIELDS)  # AVR structs are packed
+SIZE = struct.calcsize(LAYOUT)
+
+
+def crc(data):
+    return binascii.crc_hqx(data, 0)  # CRC-16/XMODEM as _crc_xmodem_update
+
+
+def unpack(body):
+    return dict(zip((name for name, kind in FIELDS), struct.unpack(LAYOUT, body)))
+
+
+def pack(config):
+    missing = [name for name, kind in FIELDS if name not in config]
+
+    if missing:
+        sys.exit("missing fields: %s" % ", ".join(missing))
+
+    return struct.pack(LAYOUT, *(config[name] for name, kind in FIELDS))
+
+
+def open_port(port):
+    link = serial.Serial()
+    link.port = port
+    link.baudrate = BAUD
+    link.timeout = TIMEOUT
+    link.dtr = False  # Avoid auto-reset into the bootloader
+    link.open()
+    link.reset_input_buffer()
+    return link
+
+
+def pull(link):
+    link.write(b"C")
+    line = link.readline().strip()
+
+    if not line.startswith(b"C"):
+        sys.exit("no reply to export")
+
+    frame = binascii.unhexlify(line[1:])
+    header, body, check = frame[:2], frame[2:-2], frame[-2:]
+
+    if (header[0] != CONFIG_KEY) or (header[1] != SIZE) or (len(body) != SIZE):
+        sys.exit("clock config layout %c/%u does not match tool %c/%u"
+                 % (header[0], header[1], CONFIG_KEY, SIZE))
+
+    if struct.unpack("<H", check)[0] != crc(header + body):
+        sys.exit("export corrupted")
+
+    return unpack(body)
+
+
+def read_reply(link, prefix, seconds):
+    deadline = time.monotonic() + seconds
+
+    while time.monotonic() < deadline:
+        line = link.readline().strip()
+
+        if line.startswith(prefix):
+            return line
+
+    return None
+
+
+def push(link, config, profile):
+    header = bytes([CONFIG_KEY, SIZE])
+    body = pack(config)
+    frame = header + body + struct.pack("<H", crc(header + body))
+    command = b"S" if profile else b"P"
+
+    for attempt in range(PUSH_ATTEMPTS):
+        # Clock reads the command only from its main loop, so the 114 byte
+        # frame would overrun its 64 byte ring if sent before it is ready
+        link.reset_input_buffer()
+        link.write(command)
+
+        if read_reply(link, command + b" ready", READY_TIMEOUT) is None:
+            continue
+
+        link.write(binascii.hexlify(frame).upper() + b"\n")
+        line = read_reply(link, command + b" result=", RESULT_TIMEOUT)
+
+        if line is None:
+            continue
+
+        result = int(line[len(command) + 8:])
+
+        if result == 0:
+            return
+
+        if result not in RETRY_RESULTS:
+            sys.exit("push rejected: %s" % RESULTS.get(result, result))
+
+    sys.exit("push failed after %u attempts" % PUSH_ATTEMPTS)
+
+
+def diff(current, golden):
+    changes = 0
+
+    for name, kind in FIELDS:
+        if current[name] != golden.get(name):
+            print("%-20s %10s -> %s" % (name, current[name], golden.get(name)))
+            changes += 1
+
+    return changes
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Provision B5441 Nixie clock Config")
+    parser.add_argument("port", help="Serial port, e.g. /dev/ttyUSB0")
+    commands = parser.add_subparsers(dest="command", required=True)
+    command = commands.add_parser("pull", help="Save clock config as JSON")
+    command.add_argument("--output", default="-")
+    command = commands.add_parser("diff", help="Compare clock config with JSON")
+    command.add_argument("file")
+    command = commands.add_parser("push", help="Write JSON to clock")
+    command.add_argument("file")
+    command.add_argument("--profile", action="store_true", help="Write site profile instead")
+    args = parser.parse_args()
+
+    link = open_port(args.port)
+
+    if args.command == "pull":
+        text = json.dumps(pull(link), indent=4) + "\n"
+
+        if args.output == "-":
+            sys.stdout.write(text)
+        else:
+            with open(args.output, "w") as f:
+                f.write(text)
+    else:
+        with open(args.file) as f:
+            golden = json.load(f)
+
+        if args.command == "diff":
+            sys.exit(1 if diff(pull(link), golden) else 0)
+
+        push(link, golden, args.profile)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 nitacku
+#
+# Replay scripted button presses into the B5441 Nixie clock over its UART
+# and report input-to-display latency per menu path.
+#
+# usage: replay.py PORT SCRIPT [--repeat N] [--settle SECONDS]
+#
+# SCRIPT holds one or more paths, each a name line followed by steps:
+#
+#     path brightness
+#     A 2000          # Hold A (enter menu), then wait 2000 ms
+#     B 300           # Press B, then wait 300 ms
+#     wait 500
+#
+# Each path should start from the clock display and return to it. After
+# a path the tool waits for menus to time out, then reads the results
+# with the 'L' telemetry command. Requires pyserial.
+
+import argparse
+import sys
+import time
+
+import serial
+
+BAUD = 57600
+TIMEOUT = 1  # Seconds
+
+# Must match Inject.h
+BUTTON = {"A": b"\x0e", "B": b"\x0f"}
+
+
+def parse(path):
+    paths = []
+
+    with open(path) as f:
+        for number, line in enumerate(f, 1):
+            fields = line.split("#")[0].split()
+
+            if not fields:
+                continue
+
+            if fields[0] == "path" and len(fields) == 2:
+                paths.append((fields[1], []))
+            elif (fields[0] in BUTTON or fields[0] == "wait") and len(fields) == 2 and paths:
+                paths[-1][1].append((fields[0], int(fields[1]) / 1000))
+            else:
+                sys.exit("%s:%u: bad step '%s'" % (path, number, line.strip()))
+
+    return paths
+
+
+def sleep_until(deadline):
+    while True:
+        remaining = deadline - time.perf_counter()
+
+        if remaining <= 0:
+            return
+
+        if remaining > 0.002:
+            time.sleep(remaining - 0.002)  # Spin the last moment for exact timing
+
+
+def play(link, steps):
+    deadline = time.perf_counter()
+
+    for step, delay in steps:
+        sleep_until(deadline)
+
+        if step in BUTTON:
+            link.write(BUTTON[step])
+            link.flush()
+
+        deadline = time.perf_counter() + delay
+
+    sleep_until(deadline)
+
+
+def collect(link):
+    link.reset_input_buffer()
+    link.write(b"L")
+    line = link.readline().decode(errors="replace").strip()
+
+    if not line.startswith("L count="):
+        sys.exit("no reply to latency export")
+
+    results = []
+
+    for index in range(int(line[8:])):
+        line = link.readline().decode(errors="replace").strip()
+        results.append(None if line == "-" else float(line))
+
+    return results
+
+
+def percentile(values, rank):
+    ordered = sorted(values)
+    return ordered[max(0, -(-len(ordered) * rank // 100) - 1)]  # Nearest rank
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Measure clock UI latency by button replay")
+    parser.add_argument("port", help="Serial port, e.g. /dev/ttyUSB0")
+    parser.add_argument("script", help="Button script")
+    parser.add_argument("--repeat", type=int, default=10, help="Runs per path")
+    parser.add_argument("--settle", type=float, default=6, help="Seconds for menus to time out")
+    args = parser.parse_args()
+
+    paths = parse(args.script)
+    link = serial.Serial()
+    link.port = args.port
+    link.baudrate = BAUD
+    link.timeout = TIMEOUT
+    link.dtr = False  # Avoid auto-reset into the bootloader
+    link.open()
+    collect(link)  # Discard stale results
+
+    print("%-16s %6s %6s %8s %8s %8s" % ("path", "inputs", "missed", "p50 ms", "p99 ms", "max ms"))
+
+    for name, steps in paths:
+        latency = []
+        missed = 0
+
+        for run in range(args.repeat):
+            play(link, steps)
+            time.sleep(args.settle)
+
+            for value in collect(link):
+                if value is None:
+                    missed += 1
+                else:
+                    latency.append(value)
+
+        if latency:
+            print("%-16s %6u %6u %8.1f %8.1f %8.1f" % (name, len(latency) + missed, missed,
+                  percentile(latency, 50), percentile(latency, 99), max(latency)))
+        else:
+            print("%-16s %6u %6u %8s %8s %8s" % (name, missed, missed, "-", "-", "-"))
+
+
+if __name__ == "__main__":
+    main()
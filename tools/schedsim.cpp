@@ -0,0 +1,241 @@
+//
+// Copyright (c) 2026 nitacku
+//
+// Replay months of B5441 Nixie clock operation on a PC. Virtual RTC time
+// advances as fast as the CPU allows through the firmware's Schedule.cpp,
+// and every alarm, alarm indicator and blank state is compared against an
+// independent reference model.
+//
+// build: g++ -std=gnu++11 -O2 -I tools/host tools/schedsim.cpp -o schedsim
+//
+// usage: schedsim [DAYS] [CONFIGS] [SEED]
+//
+// Each config is random and runs for DAYS days from a random minute of the
+// week. The main loop stall of effects and menus is modelled by skipping
+// minutes now and then, and setting the clock by jumping days ahead.
+
+#include <chrono>
+#include <random>
+#include <vector>
+#include <Arduino.h> // Shim from tools/host - after std headers as it defines min and max
+
+// Firmware source compiled into this unit unchanged
+#include "../firmware/B5441-Nixie-Clock/Schedule.cpp"
+
+static const uint32_t MISMATCH_REPORT = 10; // Printed before going quiet
+
+static std::mt19937 g_random;
+static uint32_t g_mismatch;
+
+
+static uint32_t Random(const uint32_t limit)
+{
+    return std::uniform_int_distribution<uint32_t>(0, limit - 1)(g_random);
+}
+
+
+static void Mismatch(const char* what, const uint16_t minute, const int expect, const int actual)
+{
+    if (g_mismatch++ < MISMATCH_REPORT)
+    {
+        printf("%s at day %u %02u:%02u - expected %d got %d\n",
+               what, (minute / 1440) + 1, (minute % 1440) / 60, minute % 60, expect, actual);
+    }
+}
+
+
+// Mostly ordinary settings with the edge cases the menu allows
+static void RandomConfig(Config& config)
+{
+    for (uint8_t index = 0; index < ALARM_COUNT; index++)
+    {
+        AlarmStruct& alarm = config.alarm[index];
+        alarm.state = Random(3) ? State::ENABLE : State::DISABLE;
+        alarm.days = Random(4) ? (Random(128) << 1) : 0xFE;
+        alarm.time = Random(1440) * 60;
+    }
+
+    for (uint8_t index = 0; index < BLANK_WINDOW_COUNT; index++)
+    {
+        BlankWindowStruct& window = config.blank[index];
+        window.days = Random(3) ? (Random(128) << 1) : (Random(2) ? 0xFE : 0);
+        window.begin = Random(1440);
+
+        switch (Random(4))
+        {
+        case 0:
+            window.end = window.begin; // Whole day
+            break;
+
+        case 1:
+            window.end = (window.begin + 1 + Random(5)) % 1440; // Short
+            break;
+
+        default:
+            window.end = Random(1440);
+            break;
+        }
+    }
+}
+
+
+// Reference - alarm fires on its listed days at its minute, lowest index first
+static int8_t ReferenceAlarmDue(const Config& config, const uint16_t minute)
+{
+    for (uint8_t index = 0; index < ALARM_COUNT; index++)
+    {
+        const AlarmStruct& alarm = config.alarm[index];
+
+        for (uint8_t day = 1; (alarm.state == State::ENABLE) && (day <= 7); day++)
+        {
+            if (((alarm.days >> day) & 0x1) && (minute == ((day - 1) * 1440) + (alarm.time / 60)))
+            {
+                return index;
+            }
+        }
+    }
+
+    return -1;
+}
+
+
+// Reference - indicator lit when next occurrence of any alarm time fires
+static bool ReferenceAlarmIndicator(const Config& config, const uint16_t minute)
+{
+    for (uint16_t ahead = 1; ahead <= 1440; ahead++)
+    {
+        uint16_t future = (minute + ahead) % WEEK_MINUTES;
+
+        for (uint8_t index = 0; index < ALARM_COUNT; index++)
+        {
+            const AlarmStruct& alarm = config.alarm[index];
+
+            if ((alarm.state == State::ENABLE) && ((future % 1440) == (alarm.time / 60)) &&
+                ((alarm.days >> ((future / 1440) + 1)) & 0x1))
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+
+// Reference - minute lies within some window started on one of its days
+static bool ReferenceBlanked(const Config& config, const uint16_t minute)
+{
+    for (uint8_t index = 0; index < BLANK_WINDOW_COUNT; index++)
+    {
+        const BlankWindowStruct& window = config.blank[index];
+        uint16_t length = ((window.end + 1440 - window.begin) % 1440);
+        length = (length ? length : 1440);
+
+        for (uint8_t day = 1; day <= 7; day++)
+        {
+            uint16_t begin = ((day - 1) * 1440) + window.begin;
+
+            if (((window.days >> day) & 0x1) && (((minute + WEEK_MINUTES - begin) % WEEK_MINUTES) < length))
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+
+int main(int argc, char** argv)
+{
+    uint32_t days = (argc > 1) ? atol(argv[1]) : 365;
+    uint32_t configs = (argc > 2) ? atol(argv[2]) : 100;
+    g_random.seed((argc > 3) ? atol(argv[3]) : 1);
+
+    uint64_t minutes = 0;
+    uint32_t alarms = 0;
+    uint32_t events = 0;
+    std::chrono::duration<double> elapsed(0);
+
+    for (uint32_t run = 0; run < configs; run++)
+    {
+        Config config;
+        BlankScheduleStruct schedule;
+        RandomConfig(config);
+
+        // Reference answers are precomputed so only firmware code is timed
+        std::vector<int8_t> due(WEEK_MINUTES);
+        std::vector<bool> indicator(WEEK_MINUTES);
+        std::vector<bool> blanked(WEEK_MINUTES);
+
+        for (uint16_t minute = 0; minute < WEEK_MINUTES; minute++)
+        {
+            due[minute] = ReferenceAlarmDue(config, minute);
+            indicator[minute] = ReferenceAlarmIndicator(config, minute);
+            blanked[minute] = ReferenceBlanked(config, minute);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        BlankCompile(config, schedule);
+        uint16_t minute = Random(WEEK_MINUTES);
+        bool state = !blanked[minute]; // Force a check of the adopted state
+        bool seek = false;
+
+        for (uint64_t remaining = uint64_t(days) * 1440; remaining; remaining--)
+        {
+            uint8_t week_day = (minute / 1440) + 1;
+            uint32_t time = (minute % 1440) * 60;
+            int8_t index = GetAlarmDue(config, week_day, time);
+            bool lit = (GetAlarmIndicator(config, week_day, time) == State::ENABLE);
+            BlankEvent event = GetBlankEvent(schedule, minute);
+
+            alarms += (index > -1);
+            events += (event != BlankEvent::NONE);
+
+            if (index != due[minute])
+            {
+                Mismatch("alarm", minute, due[minute], index);
+            }
+
+            if (lit != indicator[minute])
+            {
+                Mismatch("indicator", minute, indicator[minute], lit);
+            }
+
+            if (schedule.blanked != blanked[minute])
+            {
+                Mismatch("blank state", minute, blanked[minute], schedule.blanked);
+            }
+
+            // A changed state must be announced and an event must match it.
+            // State is adopted after compile, and after a clock set unless constant.
+            if (((blanked[minute] != state) || (seek && schedule.count)) && (event == BlankEvent::NONE))
+            {
+                Mismatch("blank event", minute, blanked[minute], -1);
+            }
+
+            if ((event != BlankEvent::NONE) && ((event == BlankEvent::BLANK) != blanked[minute]))
+            {
+                Mismatch("blank event", minute, blanked[minute], event == BlankEvent::BLANK);
+            }
+
+            state = blanked[minute];
+            seek = false;
+
+            // Stall for a few minutes or set the clock days ahead
+            uint32_t chance = Random(10000);
+            uint16_t step = (chance < 20) ? (2 + Random(120)) : ((chance < 22) ? (1441 + Random(5000)) : 1);
+            seek = (step > BLANK_STALL_LIMIT);
+            minute = (minute + step) % WEEK_MINUTES;
+            minutes++;
+        }
+
+        elapsed += std::chrono::steady_clock::now() - start;
+    }
+
+    double simulated = minutes / 1440.0;
+    printf("%u configs, %.0f simulated days, %u alarms, %u blank events, %u mismatches\n",
+           configs, simulated, alarms, events, g_mismatch);
+    printf("%.0f simulated days per second\n", simulated / elapsed.count());
+    return (g_mismatch ? 1 : 0);
+}
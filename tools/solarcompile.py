@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 nitacku
+#
+# Compile the PROGMEM solar tables used by the B5441 Nixie clock firmware
+# (SolarTable.h).
+#
+# usage: solarcompile.py [--output FILE]
+#
+# Declination and equation of time depend only on the day of year, so one
+# table serves every location. The firmware combines them with latitude,
+# longitude and the time of day using the sine table below - no floating
+# point is needed on the clock.
+
+import argparse
+import math
+
+STEP_DAYS = 5  # SOLAR_STEP_DAYS
+TURN = 65536  # Angle units per revolution
+SINE_COUNT = 65  # Quarter wave inclusive of both ends
+SINE_ONE = 1 << 14  # SOLAR_ONE
+
+
+def solar(day):
+    # NOAA fractional year approximation evaluated at noon
+    gamma = 2 * math.pi * (day + 0.5) / 365
+    declination = (0.006918 - 0.399912 * math.cos(gamma) + 0.070257 * math.sin(gamma)
+                   - 0.006758 * math.cos(2 * gamma) + 0.000907 * math.sin(2 * gamma)
+                   - 0.002697 * math.cos(3 * gamma) + 0.00148 * math.sin(3 * gamma))
+    equation = 229.18 * (0.000075 + 0.001868 * math.cos(gamma) - 0.032077 * math.sin(gamma)
+                         - 0.014615 * math.cos(2 * gamma) - 0.040849 * math.sin(2 * gamma))
+    return declination, equation  # Radians, minutes
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compile solar tables into SolarTable.h")
+    parser.add_argument("--output", default="-")
+    args = parser.parse_args()
+
+    lines = [
+        "// Generated by tools/solarcompile.py - do not edit",
+        "",
+        "#ifndef _SOLAR_TABLE_H",
+        "#define _SOLAR_TABLE_H",
+        "",
+        "// Quarter wave, one entry per %u angle units" % (TURN // 4 // (SINE_COUNT - 1)),
+        "const uint16_t sine_table[%u] PROGMEM =" % SINE_COUNT,
+        "{",
+    ]
+
+    values = [round(math.sin(math.pi / 2 * index / (SINE_COUNT - 1)) * SINE_ONE) for index in range(SINE_COUNT)]
+
+    for index in range(0, SINE_COUNT, 8):
+        lines.append("    " + " ".join("%5u," % value for value in values[index:index + 8]))
+
+    # Spans day 365 of leap years plus one entry for interpolation
+    count = 366 // STEP_DAYS + 2
+
+    lines += [
+        "};",
+        "",
+        "// Every %u days from 1 January - angles in 1/%u turn" % (STEP_DAYS, TURN),
+        "const SolarEntry solar_table[%u] PROGMEM =" % count,
+        "{",
+    ]
+
+    for index in range(count):
+        day = index * STEP_DAYS
+        declination, equation = solar(day)
+        lines.append("    {%6d, %5d}, // Day %3u %+6.2f deg %+6.2f min"
+                     % (round(declination / (2 * math.pi) * TURN), round(equation / 1440 * TURN),
+                        day, math.degrees(declination), equation))
+
+    lines += ["};", "", "#endif", ""]
+
+    text = "\n".join(lines)
+
+    if args.output == "-":
+        print(text, end="")
+    else:
+        with open(args.output, "w") as f:
+            f.write(text)
+
+
+if __name__ == "__main__":
+    main()
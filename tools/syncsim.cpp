@@ -0,0 +1,294 @@
+//
+// Copyright (c) 2026 nitacku
+//
+// Chain simulated B5441 Nixie clocks through the firmware's SyncFrame.cpp
+// and check that every unit latches each second within one display
+// refresh phase of the others, showing the frame of the marker's second.
+//
+// build: g++ -std=gnu++11 -O2 -I tools/host tools/syncsim.cpp -o syncsim
+//
+// usage: syncsim [SECONDS] [UNITS] [SEED]
+//
+// Unit 0 is the master. Each byte crosses a link in one byte time at the
+// line baud, a follower forwards it from a receive interrupt serviced a
+// little late, and its main loop prepares the next frame at a random point
+// that may fall before or after the latch. Each unit counts down on its
+// own Timer0 compare tick, unaligned and drifting as resonators do.
+
+#include <queue>
+#include <vector>
+#include <random>
+#include <string>
+#include <Arduino.h> // Shim from tools/host - after std headers as it defines min and max
+
+// Firmware source compiled into this unit unchanged
+#include "../firmware/B5441-Nixie-Clock/SyncFrame.cpp"
+
+static const double BYTE_US = 10 * 1000000.0 / TELEMETRY_BAUD; // Line rate, not rounded
+static const double RECEIVE_US = BYTE_US * 0.95; // Receiver completes mid stop bit
+static const double SERVICE_US = 20; // Most receive interrupt latency
+static const double PREPARE_US = 40000; // Most main loop delay before next frame
+static const double EDGE_US = 50000; // Most main loop delay of master edge
+static const double DRIFT_PPM = 100; // Most tick rate error of a unit
+static const double PHASE_US = 1024.0 * (INTERRUPT_FAST + 1) * 1000000 / F_CPU; // Refresh phase
+static const uint32_t MISMATCH_REPORT = 10; // Printed before going quiet
+
+enum EventKind : uint8_t
+{
+    EVENT_EDGE,     // Master second edge
+    EVENT_BYTE,     // Byte received complete
+    EVENT_PREPARE,  // Main loop prepares next frame
+    EVENT_TICK,     // Timer0 compare interrupt
+};
+
+struct Event
+{
+    double      time;
+    EventKind   kind;
+    uint8_t     unit;
+    uint8_t     data;
+    uint32_t    second; // Second since start of run
+
+    bool operator>(const Event& other) const
+    {
+        return time > other.time;
+    }
+};
+
+struct Unit
+{
+    SyncParserStruct    parser;
+    SyncStruct          sync;
+    double              phase;      // Offset of first tick
+    double              period;     // Tick interval
+    double              transmit;   // Transmitter busy until
+    uint32_t            armed;      // Second of armed frame
+};
+
+static std::mt19937 g_random;
+static std::priority_queue<Event, std::vector<Event>, std::greater<Event>> g_event;
+static uint32_t g_mismatch;
+
+
+static double Random(const double limit)
+{
+    return std::uniform_real_distribution<double>(0, limit)(g_random);
+}
+
+
+static void Mismatch(const char* what, const uint32_t second, const uint8_t unit)
+{
+    if (g_mismatch++ < MISMATCH_REPORT)
+    {
+        printf("%s at second %u unit %u\n", what, second, unit);
+    }
+}
+
+
+// Clock face of second since start of run - as FormatRTCString would show
+static std::string Face(const uint32_t second)
+{
+    char s[DISPLAY_COUNT + 1];
+    snprintf(s, sizeof(s), "%02u:%02u:%02u", (second / 3600) % 24, (second / 60) % 60, second % 60);
+    return std::string(s, DISPLAY_COUNT);
+}
+
+
+static void Push(const double time, const EventKind kind, const uint8_t unit,
+                 const uint8_t data, const uint32_t second)
+{
+    g_event.push(Event{time, kind, unit, data, second});
+}
+
+
+// First tick of unit strictly after time
+static double NextTick(const Unit& unit, const double time)
+{
+    return (floor((time - unit.phase) / unit.period) + 1) * unit.period + unit.phase;
+}
+
+
+static void Transmit(std::vector<Unit>& units, const uint8_t index, const double time,
+                     const uint8_t data, const uint32_t second)
+{
+    Unit& unit = units[index];
+
+    if ((index + 1U) < units.size())
+    {
+        double start = max(time, unit.transmit);
+        unit.transmit = start + BYTE_US;
+        Push(start + RECEIVE_US, EVENT_BYTE, index + 1, data, second);
+    }
+}
+
+
+int main(int argc, char** argv)
+{
+    uint32_t seconds = (argc > 1) ? atol(argv[1]) : 3600;
+    uint8_t count = (argc > 2) ? atol(argv[2]) : 8;
+    g_random.seed((argc > 3) ? atol(argv[3]) : 1);
+
+    std::vector<Unit> units(count);
+    std::vector<std::vector<double>> latch(seconds, std::vector<double>(count, -1));
+    uint32_t unprepared = 0;
+
+    for (Unit& unit : units)
+    {
+        memset(&unit.parser, 0, sizeof(unit.parser));
+        memset(&unit.sync, 0, sizeof(unit.sync));
+        unit.sync.frame[0].second = 0xFF;
+        unit.sync.frame[1].second = 0xFF;
+        unit.phase = Random(SYNC_TICK_US);
+        unit.period = SYNC_TICK_US * (1 + (Random(2 * DRIFT_PPM) - DRIFT_PPM) / 1000000);
+        unit.transmit = 0;
+    }
+
+    for (uint32_t second = 0; second < seconds; second++)
+    {
+        Push((second * 1000000.0) + Random(EDGE_US), EVENT_EDGE, 0, 0, second);
+    }
+
+    while (!g_event.empty())
+    {
+        Event event = g_event.top();
+        g_event.pop();
+        Unit& unit = units[event.unit];
+
+        switch (event.kind)
+        {
+        case EVENT_EDGE:
+        {
+            uint8_t frame[SYNC_FRAME_SIZE];
+            uint32_t second = event.second;
+            SyncBuild(frame, (second / 3600) % 24, (second / 60) % 60, second % 60);
+            SyncPrepare(unit.sync, second % 60, Face(second).c_str());
+            double tick = NextTick(unit, event.time);
+            SyncArm(unit.sync, second % 60, GetSyncCountdown(SYNC_DELAY_MS * 1000UL, tick - event.time));
+            unit.armed = second;
+            Push(tick, EVENT_TICK, 0, 0, second);
+
+            for (uint8_t index = 0; index < SYNC_FRAME_SIZE; index++)
+            {
+                Transmit(units, 0, event.time, frame[index], second);
+            }
+
+            break;
+        }
+
+        case EVENT_BYTE:
+        {
+            double time = event.time + Random(SERVICE_US);
+            uint8_t forward;
+            SyncByte result = SyncParse(unit.parser, event.data, time, forward);
+
+            if (result == SyncByte::OTHER)
+            {
+                break;
+            }
+
+            Transmit(units, event.unit, time, forward, event.second);
+
+            if (result != SyncByte::FRAME)
+            {
+                break;
+            }
+
+            double tick = NextTick(unit, time);
+
+            if (SyncArm(unit.sync, unit.parser.buffer[4], GetSyncLatchDelay(unit.parser, time, tick - time)))
+            {
+                unit.armed = event.second;
+                Push(tick, EVENT_TICK, event.unit, 0, event.second);
+            }
+            else if (event.second)
+            {
+                Mismatch("unprepared", event.second, event.unit);
+            }
+            else
+            {
+                unprepared++; // First marker arrives before any frame
+            }
+
+            Push(time + Random(PREPARE_US), EVENT_PREPARE, event.unit, 0, event.second + 1);
+            break;
+        }
+
+        case EVENT_PREPARE:
+            SyncPrepare(unit.sync, event.second % 60, Face(event.second).c_str());
+            break;
+
+        case EVENT_TICK:
+        {
+            SyncFrameStruct* frame = SyncExpire(unit.sync);
+
+            if (frame)
+            {
+                if (std::string(frame->value, DISPLAY_COUNT) != Face(unit.armed))
+                {
+                    Mismatch("wrong frame", unit.armed, event.unit);
+                }
+
+                latch[unit.armed][event.unit] = event.time;
+            }
+            else if (unit.sync.countdown)
+            {
+                Push(event.time + unit.period, EVENT_TICK, event.unit, 0, event.second);
+            }
+
+            break;
+        }
+        }
+    }
+
+    // Offset of each unit from the master, and spread of each second
+    std::vector<double> offset(count, 0);
+    std::vector<double> worst(count, 0);
+    double spread = 0;
+
+    for (uint32_t second = 1; second < seconds; second++)
+    {
+        double early = latch[second][0];
+        double late = latch[second][0];
+
+        for (uint8_t index = 0; index < count; index++)
+        {
+            double time = latch[second][index];
+
+            if (time < 0)
+            {
+                Mismatch("no latch", second, index);
+                continue;
+            }
+
+            offset[index] += (time - latch[second][0]) / (seconds - 1);
+            worst[index] = max(worst[index], fabs(time - latch[second][0]));
+            early = min(early, time);
+            late = max(late, time);
+        }
+
+        if ((late - early) > PHASE_US)
+        {
+            Mismatch("spread exceeds refresh phase", second, 0);
+        }
+
+        spread = max(spread, late - early);
+    }
+
+    printf("unit  mean us   max us\n");
+
+    for (uint8_t index = 1; index < count; index++)
+    {
+        printf("%4u %8.1f %8.1f\n", index, offset[index], worst[index]);
+
+        // Tick rounding averages out as phases drift - a bias means the
+        // latency is miscounted
+        if (fabs(offset[index]) > (BYTE_US / 2))
+        {
+            Mismatch("mean offset exceeds half a byte time", 0, index);
+        }
+    }
+
+    printf("%u units, %u seconds, %u unprepared first markers, spread %.0f of %.0f us, %u mismatches\n",
+           count, seconds, unprepared, spread, PHASE_US, g_mismatch);
+    return (g_mismatch ? 1 : 0);
+}
@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 nitacku
+#
+# Decode the B5441 Nixie clock event trace into Chrome trace JSON, which
+# chrome://tracing and ui.perfetto.dev both open.
+#
+# usage: tracedecode.py --port PORT [--output FILE]
+#        tracedecode.py CAPTURE [--output FILE]
+#
+# The firmware must be built with TRACE_ENABLE set to 1 in Trace.h.
+# CAPTURE is text saved from the 'T' telemetry command.
+
+import argparse
+import json
+import sys
+
+BAUD = 57600
+TICK_US = 4  # TRACE_TICK_US
+BEGIN_FLAG = 0x40
+END_FLAG = 0x80
+
+# Must match enum TraceEvent in Trace.h
+EVENTS = [
+    "epoch",
+    "second",
+    "display isr",
+    "tick isr",
+    "uart rx",
+    "i2c",
+    "config",
+    "effect",
+    "button",
+    "audio",
+]
+
+EPOCH = 0
+
+
+def read_port(port):
+    import serial
+
+    link = serial.Serial()
+    link.port = port
+    link.baudrate = BAUD
+    link.timeout = 1
+    link.dtr = False  # Avoid auto-reset into the bootloader
+    link.open()
+    link.reset_input_buffer()
+    link.write(b"T")
+    lines = []
+
+    while True:
+        line = link.readline().decode(errors="replace")
+
+        if not line:
+            sys.exit("trace export timed out")
+
+        lines.append(line)
+
+        if line.startswith("T end"):
+            return lines
+
+
+def decode(lines):
+    events = []
+    ticks = None
+    previous = 0
+    started = False
+
+    for line in lines:
+        line = line.strip()
+
+        if line.startswith("T count="):
+            started = True
+            fields = dict(item.split("=") for item in line[2:].split())
+
+            if int(fields["lost"]):
+                sys.stderr.write("%s records overwritten before export\n" % fields["lost"])
+
+            continue
+
+        if not started or line.startswith("T end") or not line:
+            continue
+
+        stamp, event, arg = (int(field, 16) for field in line.split())
+
+        # Stamps are the low 16 bits of time - unwrap against previous record
+        if ticks is None:
+            ticks = 0
+        else:
+            ticks += (stamp - previous) & 0xFFFF
+
+        previous = stamp
+        kind = event & ~(BEGIN_FLAG | END_FLAG)
+
+        if kind == EPOCH:
+            ticks += arg << 16
+            continue
+
+        name = EVENTS[kind] if kind < len(EVENTS) else "event %u" % kind
+        record = {"name": name, "pid": 0, "tid": kind, "ts": ticks * TICK_US, "args": {"arg": arg}}
+
+        if event & BEGIN_FLAG:
+            record["ph"] = "B"
+        elif event & END_FLAG:
+            record["ph"] = "E"
+        else:
+            record["ph"] = "i"
+            record["s"] = "t"
+
+        events.append(record)
+
+    # Name one track per event kind
+    for kind, name in enumerate(EVENTS):
+        events.append({"name": "thread_name", "ph": "M", "pid": 0, "tid": kind, "args": {"name": name}})
+
+    return {"traceEvents": events, "displayTimeUnit": "ms"}
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode clock trace to Chrome trace JSON")
+    parser.add_argument("capture", nargs="?", help="Text captured from 'T' command")
+    parser.add_argument("--port", help="Serial port to drain, e.g. /dev/ttyUSB0")
+    parser.add_argument("--output", default="-")
+    args = parser.parse_args()
+
+    if args.port:
+        lines = read_port(args.port)
+    elif args.capture:
+        with open(args.capture) as f:
+            lines = f.readlines()
+    else:
+        parser.error("give a capture file or --port")
+
+    text = json.dumps(decode(lines)) + "\n"
+
+    if args.output == "-":
+        sys.stdout.write(text)
+    else:
+        with open(args.output, "w") as f:
+            f.write(text)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 nitacku
+#
+# Compile timezone rules into the PROGMEM transition table used by the
+# B5441 Nixie clock firmware (TimezoneTable.h).
+#
+# usage: tzcompile.py ZONE [--begin YEAR] [--end YEAR] [--output FILE]
+#
+# Each transition is keyed by the local wall time, before the change, at
+# which it occurs. The firmware keeps the RTC in local time and compares
+# the current packed time against the next key only.
+
+import argparse
+import datetime
+import sys
+import zlib
+from zoneinfo import ZoneInfo
+
+OFFSET_UNIT = 15  # Minutes per offset unit
+KEY_END = 0xFFFFFFFF  # Sentinel - never reached
+
+
+def pack(t):
+    # year:7 month:4 day:5 hour:5 minute:6 - orders like the time itself
+    return ((t.year - 2000) << 20) | (t.month << 16) | (t.day << 11) | (t.hour << 6) | t.minute
+
+
+def offset_units(zone, utc):
+    minutes = int(utc.astimezone(zone).utcoffset().total_seconds()) // 60
+
+    if minutes % OFFSET_UNIT:
+        sys.exit("offset %d minutes is not a multiple of %d" % (minutes, OFFSET_UNIT))
+
+    return minutes // OFFSET_UNIT
+
+
+def transitions(zone, begin, end):
+    utc = datetime.datetime(begin, 1, 1, tzinfo=datetime.timezone.utc)
+    stop = datetime.datetime(end + 1, 1, 1, tzinfo=datetime.timezone.utc)
+    step = datetime.timedelta(hours=1)
+    base = offset_units(zone, utc)
+    previous = base
+    result = []
+
+    while utc < stop:
+        current = offset_units(zone, utc + step)
+
+        if current != previous:
+            # Narrow to the minute of the change
+            low, high = utc, utc + step
+
+            while (high - low) > datetime.timedelta(minutes=1):
+                middle = low + (high - low) / 2
+
+                if offset_units(zone, middle) == previous:
+                    low = middle
+                else:
+                    high = middle
+
+            local = (high + datetime.timedelta(minutes=previous * OFFSET_UNIT)).replace(tzinfo=None)
+            result.append((pack(local), current, local))
+            previous = current
+
+        utc += step
+
+    return base, result
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compile tz rules into TimezoneTable.h")
+    parser.add_argument("zone", help="IANA zone name, e.g. Europe/London")
+    parser.add_argument("--begin", type=int, default=datetime.date.today().year)
+    parser.add_argument("--end", type=int, default=datetime.date.today().year + 20)
+    parser.add_argument("--output", default="-")
+    args = parser.parse_args()
+
+    if not (2000 <= args.begin <= args.end <= 2099):
+        sys.exit("years must lie within 2000-2099 to match the RTC")
+
+    zone = ZoneInfo(args.zone)
+    base, table = transitions(zone, args.begin, args.end)
+    signature = "%s %d %d %d" % (args.zone, args.begin, args.end, len(table))
+    table_id = zlib.crc32(signature.encode()) & 0xFFFF
+
+    lines = [
+        "// Generated by tools/tzcompile.py - do not edit",
+        "// %s %d-%d" % (args.zone, args.begin, args.end),
+        "",
+        "#ifndef _TIMEZONE_TABLE_H",
+        "#define _TIMEZONE_TABLE_H",
+        "",
+        "const uint16_t TIMEZONE_TABLE_ID = 0x%04X;" % table_id,
+        "const int8_t TIMEZONE_BASE_OFFSET = %d; // Before first transition" % base,
+        "",
+        "const TimezoneTransition timezone_table[] PROGMEM =",
+        "{",
+    ]
+
+    for key, offset, local in table:
+        lines.append("    {0x%08X, %3d}, // %s" % (key, offset, local.strftime("%Y-%m-%d %H:%M")))
+
+    lines.append("    {0x%08X, %3d}, // End" % (KEY_END, table[-1][1] if table else base))
+    lines += ["};", "", "#endif", ""]
+
+    text = "\n".join(lines)
+
+    if args.output == "-":
+        sys.stdout.write(text)
+    else:
+        with open(args.output, "w") as f:
+            f.write(text)
+
+
+if __name__ == "__main__":
+    main()